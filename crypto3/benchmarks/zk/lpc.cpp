@@ -30,6 +30,7 @@
 #define PROFILING_ENABLED
 
 #include <string>
+#include <fstream>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -105,6 +106,26 @@ inline std::vector<std::size_t> generate_random_step_list(const std::size_t r, c
     return step_list;
 }
 
+// Returns the value of the given memory counter of /proc/self/status in bytes, 0 if it is not available.
+inline std::size_t read_process_memory_counter(const std::string &name) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind(name + ":", 0) == 0) {
+            return std::stoul(line.substr(name.size() + 1)) * 1024;
+        }
+    }
+    return 0;
+}
+
+// Resets the peak resident set size of the process to the current one, returns false if it is not supported.
+inline bool reset_peak_rss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+    clear_refs.flush();
+    return clear_refs.good() && read_process_memory_counter("VmHWM") != 0;
+}
+
 BOOST_AUTO_TEST_SUITE(lpc_performance_test_suite)
 
 void lpc_test_case(std::size_t steps)
@@ -212,4 +233,61 @@ BOOST_AUTO_TEST_CASE(step_list_5) {
     lpc_test_case(5);
 }
 
+// Peak memory of the FRI precommit on top of the batch it commits to.
+void precommit_peak_memory_test_case(std::size_t degree_log, std::size_t batch_size)
+{
+        typedef algebra::curves::bls12<381> curve_type;
+        typedef typename curve_type::scalar_field_type FieldType;
+        typedef typename FieldType::value_type value_type;
+
+        typedef hashes::keccak_1600<256> merkle_hash_type;
+        typedef hashes::keccak_1600<256> transcript_hash_type;
+
+        constexpr static const std::size_t lambda = 40;
+        constexpr static const std::size_t m = 2;
+
+        typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+
+        typename fri_type::params_type fri_params(1, degree_log, lambda, 2 /*expand_factor*/);
+        const std::size_t domain_size = fri_params.D[0]->size();
+
+        std::vector<math::polynomial_dfs<value_type>> batch(
+                batch_size, math::polynomial_dfs<value_type>(domain_size - 1, domain_size));
+        for (std::size_t i = 0; i < batch_size; i++) {
+            for (std::size_t j = 0; j < domain_size; j++) {
+                batch[i][j] = value_type(i * domain_size + j);
+            }
+        }
+        const std::size_t batch_bytes = batch_size * domain_size * sizeof(value_type);
+
+        if (!reset_peak_rss()) {
+            BOOST_TEST_MESSAGE("Peak RSS can not be reset, precommit memory is not measured");
+            return;
+        }
+        const std::size_t rss_before = read_process_memory_counter("VmRSS");
+        {
+            PROFILE_SCOPE("FRI precommit of " + std::to_string(batch_size) + " polynomials of size " +
+                          std::to_string(domain_size));
+            // precommit takes the batch by value, move it so that it is not copied.
+            auto tree = zk::algorithms::precommit<fri_type>(
+                    std::move(batch), fri_params.D[0], fri_params.step_list.front());
+        }
+        const std::size_t peak_growth = read_process_memory_counter("VmHWM") - rss_before;
+
+        std::cout << "FRI precommit peak RSS growth: " << (peak_growth >> 20) << " MiB, batch: "
+                  << (batch_bytes >> 20) << " MiB" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(precommit_peak_memory_2_20_x_8) {
+    precommit_peak_memory_test_case(18, 8);
+}
+
+BOOST_AUTO_TEST_CASE(precommit_peak_memory_2_20_x_16) {
+    precommit_peak_memory_test_case(18, 16);
+}
+
+BOOST_AUTO_TEST_CASE(precommit_peak_memory_2_22_x_4) {
+    precommit_peak_memory_test_case(20, 4);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
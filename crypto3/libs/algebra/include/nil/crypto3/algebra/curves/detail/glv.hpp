@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_GLV_HPP
+#define CRYPTO3_ALGEBRA_CURVES_GLV_HPP
+
+#include <type_traits>
+
+#include <boost/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /**
+                     * The curves with an efficient endomorphism (x, y) -> (glv_beta * x, y), which is the
+                     * multiplication by glv_lambda on the subgroup of order r, define glv_beta and glv_lambda in the
+                     * parameters of the group, along with the constants of glv_decompose. glv_beta and glv_lambda
+                     * are cube roots of unity, which curves y^2 = x^3 + b have when p = 1 mod 3 (Gallant, Lambert,
+                     * Vanstone, CRYPTO 2001).
+                     */
+                    template<typename CurveElementType, typename = void>
+                    struct has_glv_endomorphism : std::false_type { };
+
+                    template<typename CurveElementType>
+                    struct has_glv_endomorphism<CurveElementType,
+                                                std::void_t<decltype(CurveElementType::params_type::glv_beta)>>
+                        : std::true_type { };
+
+                    /**
+                     * Returns glv_lambda * point. In all the coordinates of short Weierstrass curves x is X divided
+                     * by a power of Z, so multiplying X by glv_beta is enough.
+                     */
+                    template<typename CurveElementType>
+                    constexpr CurveElementType glv_endomorphism(const CurveElementType &point) {
+                        CurveElementType result = point;
+                        result.X *= CurveElementType::params_type::glv_beta;
+                        return result;
+                    }
+
+                    /// k = (k1_negative ? -k1 : k1) + (k2_negative ? -k2 : k2) * glv_lambda mod r.
+                    template<typename IntegralType>
+                    struct glv_decomposition {
+                        IntegralType k1;
+                        IntegralType k2;
+                        bool k1_negative;
+                        bool k2_negative;
+                    };
+
+                    /**
+                     * Splits the scalar k into k1 + k2 * glv_lambda mod r, where k1 and k2 have about half the bits
+                     * of r. (a1, b1), (a2, b2) is a short basis of the lattice of (a, b) with a + b * glv_lambda = 0
+                     * mod r, b1 <= 0 <= b2 and a1 * b2 - a2 * b1 = r, so (k, 0) - c1 * (a1, b1) - c2 * (a2, b2)
+                     * is a short vector for (c1, c2) = round((k * b2, -k * b1) / r). The parameters keep -b1 and
+                     * b2, and glv_g1 = round(2^n * b2 / r), glv_g2 = round(-2^n * b1 / r), where n is the number
+                     * of bits of r, so that the rounding takes two multiplications and shifts. An error of the
+                     * rounding makes k1 and k2 a little longer, but never wrong: k2 = -c1 * b1 - c2 * b2 and
+                     * k1 = k - k2 * glv_lambda.
+                     */
+                    template<typename ParamsType>
+                    constexpr glv_decomposition<typename ParamsType::scalar_field_type::integral_type>
+                        glv_decompose(const typename ParamsType::scalar_field_type::value_type &k) {
+
+                        using scalar_field_type = typename ParamsType::scalar_field_type;
+                        using scalar_value_type = typename scalar_field_type::value_type;
+                        using integral_type = typename scalar_field_type::integral_type;
+                        using extended_integral_type = boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<2 * scalar_field_type::modulus_bits>>;
+
+                        constexpr std::size_t shift = scalar_field_type::modulus_bits;
+
+                        const extended_integral_type k_extended = static_cast<integral_type>(k.data);
+                        const extended_integral_type half = extended_integral_type(1u) << (shift - 1);
+                        const extended_integral_type c1 =
+                            (k_extended * extended_integral_type(ParamsType::glv_g1) + half) >> shift;
+                        const extended_integral_type c2 =
+                            (k_extended * extended_integral_type(ParamsType::glv_g2) + half) >> shift;
+
+                        const scalar_value_type k2 = scalar_value_type(c1) * ParamsType::glv_minus_b1 -
+                                                     scalar_value_type(c2) * ParamsType::glv_b2;
+                        const scalar_value_type k1 = k - k2 * ParamsType::glv_lambda;
+
+                        glv_decomposition<integral_type> result {};
+                        // A negative value -v is r - v, which is the larger one of the value and its negation.
+                        const integral_type k1_value = static_cast<integral_type>(k1.data);
+                        const integral_type k1_negated = static_cast<integral_type>((-k1).data);
+                        result.k1_negative = k1_negated < k1_value;
+                        result.k1 = result.k1_negative ? k1_negated : k1_value;
+
+                        const integral_type k2_value = static_cast<integral_type>(k2.data);
+                        const integral_type k2_negated = static_cast<integral_type>((-k2).data);
+                        result.k2_negative = k2_negated < k2_value;
+                        result.k2 = result.k2_negative ? k2_negated : k2_value;
+
+                        return result;
+                    }
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_GLV_HPP
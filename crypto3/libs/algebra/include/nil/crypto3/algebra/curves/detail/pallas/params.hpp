@@ -75,6 +75,21 @@ namespace nil {
                         constexpr static std::array<typename field_type::value_type, 2> one_fill = {
                             field_type::modulus - 1,
                             typename field_type::value_type(2u)};
+
+                        /* GLV endomorphism (x, y) -> (glv_beta * x, y), which is the multiplication by glv_lambda,
+                         * and the constants of its scalar decomposition, see curves/detail/glv.hpp */
+                        constexpr static typename field_type::value_type glv_beta =
+                            typename field_type::value_type(0x12ccca834acdba712caad5dc57aab1b01d1f8bd237ad31491dad5ebdfdfe4ab9_cppui_modular255);
+                        constexpr static typename scalar_field_type::value_type glv_lambda =
+                            typename scalar_field_type::value_type(0x6819a58283e528e511db4d81cf70f5a0fed467d47c033af2aa9d2e050aa0e4f_cppui_modular255);
+                        constexpr static typename scalar_field_type::value_type glv_minus_b1 =
+                            typename scalar_field_type::value_type(0x49e69d1640a899538cb1279300000000_cppui_modular255);
+                        constexpr static typename scalar_field_type::value_type glv_b2 =
+                            typename scalar_field_type::value_type(0x93cd3a2c8198e2690c7c095a00000001_cppui_modular255);
+                        constexpr static typename scalar_field_type::integral_type glv_g1 =
+                            0x1279a74590331c4d218f812b400000001_cppui_modular255;
+                        constexpr static typename scalar_field_type::integral_type glv_g2 =
+                            0x93cd3a2c815132a719624f2600000000_cppui_modular255;
 #endif
                     };
 
@@ -87,6 +102,18 @@ namespace nil {
                         pallas_g1_params<forms::short_weierstrass>::zero_fill;
                     constexpr std::array<typename pallas_g1_params<forms::short_weierstrass>::field_type::value_type, 2>
                         pallas_g1_params<forms::short_weierstrass>::one_fill;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::field_type::value_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_beta;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_lambda;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_minus_b1;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_b2;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_g1;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_g2;
 #endif
 
                 }    // namespace detail
@@ -36,6 +36,7 @@
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
 #include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -81,13 +82,90 @@ namespace nil {
                         }
                     }
 
+                    /**
+                     * k * base = k1 * base + k2 * glv_endomorphism(base), see glv_decompose. Both halves are
+                     * processed together in wNAF form, so the number of doublings is halved. The endomorphism is
+                     * the multiplication by glv_lambda only in the subgroup of order r, where base must lie.
+                     */
+                    template<typename CurveElementType>
+                    constexpr void glv_scalar_mul_inplace(
+                            CurveElementType &base,
+                            typename CurveElementType::params_type::scalar_field_type::value_type const& scalar)
+                    {
+                        if (scalar.is_zero()) {
+                            base = CurveElementType::zero();
+                            return;
+                        }
+
+                        auto decomposition = glv_decompose<typename CurveElementType::params_type>(scalar);
+                        if (decomposition.k1_negative) {
+                            base = -base;
+                        }
+
+                        const size_t window_size = 3;
+                        auto naf1 = boost::multiprecision::eval_find_wnaf_a(window_size + 1, decomposition.k1.backend());
+                        auto naf2 = boost::multiprecision::eval_find_wnaf_a(window_size + 1, decomposition.k2.backend());
+                        std::array<CurveElementType, 1ul << window_size > table1;
+                        std::array<CurveElementType, 1ul << window_size > table2;
+                        CurveElementType dbl = base;
+                        dbl.double_inplace();
+                        for (size_t i = 0; i < 1ul << window_size; ++i) {
+                            table1[i] = base;
+                            // The multiples of the endomorphism of base come almost for free.
+                            table2[i] = glv_endomorphism(base);
+                            if (decomposition.k1_negative != decomposition.k2_negative) {
+                                table2[i] = -table2[i];
+                            }
+                            base += dbl;
+                        }
+
+                        base = CurveElementType::zero();
+                        bool found_nonzero = false;
+                        for (long i = naf1.size() - 1; i >= 0; --i) {
+                            if (found_nonzero) {
+                                base.double_inplace();
+                            }
+
+                            if (naf1[i] != 0) {
+                                found_nonzero = true;
+                                if (naf1[i] > 0) {
+                                    base += table1[naf1[i] / 2];
+                                } else {
+                                    base -= table1[(-naf1[i]) / 2];
+                                }
+                            }
+
+                            if (naf2[i] != 0) {
+                                found_nonzero = true;
+                                if (naf2[i] > 0) {
+                                    base += table2[naf2[i] / 2];
+                                } else {
+                                    base -= table2[(-naf2[i]) / 2];
+                                }
+                            }
+                        }
+                    }
+
+                    /// Multiplication by an element of the scalar field, with the GLV method where the curve has it.
+                    template<typename CurveElementType>
+                    constexpr void scalar_mul_inplace(
+                            CurveElementType &base,
+                            typename CurveElementType::params_type::scalar_field_type::value_type const& scalar)
+                    {
+                        if constexpr (has_glv_endomorphism<CurveElementType>::value) {
+                            glv_scalar_mul_inplace(base, scalar);
+                        } else {
+                            using scalar_integral_type = typename CurveElementType::params_type::scalar_field_type::integral_type;
+                            scalar_mul_inplace(base, static_cast<scalar_integral_type>(scalar.data));
+                        }
+                    }
+
                     template<typename CurveElementType>
                     constexpr CurveElementType& operator *= (
                             CurveElementType& point,
                             typename CurveElementType::params_type::scalar_field_type::value_type const& scalar)
                     {
-                        using scalar_integral_type = typename CurveElementType::params_type::scalar_field_type::integral_type;
-                        scalar_mul_inplace(point, static_cast<scalar_integral_type>(scalar.data));
+                        scalar_mul_inplace(point, scalar);
                         return point;
                     }
 
@@ -96,9 +174,8 @@ namespace nil {
                             CurveElementType const& point,
                             typename CurveElementType::params_type::scalar_field_type::value_type const& scalar)
                     {
-                        using scalar_integral_type = typename CurveElementType::params_type::scalar_field_type::integral_type;
                         CurveElementType res = point;
-                        scalar_mul_inplace(res, static_cast<scalar_integral_type>(scalar.data));
+                        scalar_mul_inplace(res, scalar);
                         return res;
                     }
 
@@ -107,9 +184,8 @@ namespace nil {
                             typename CurveElementType::params_type::scalar_field_type::value_type const& scalar,
                             CurveElementType const& point)
                     {
-                        using scalar_integral_type = typename CurveElementType::params_type::scalar_field_type::integral_type;
                         CurveElementType res = point;
-                        scalar_mul_inplace(res, static_cast<scalar_integral_type>(scalar.data));
+                        scalar_mul_inplace(res, scalar);
                         return res;
                     }
 
@@ -218,6 +218,23 @@ namespace nil {
                                 0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798_cppui_modular256),
                             typename field_type::value_type(
                                 0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8_cppui_modular256)};
+
+                        /* GLV endomorphism (x, y) -> (glv_beta * x, y), which is the multiplication by glv_lambda,
+                         * and the constants of its scalar decomposition, see curves/detail/glv.hpp */
+                        constexpr static const typename field_type::value_type glv_beta =
+                            typename field_type::value_type(
+                                0x851695d49a83f8ef919bb86153cbcb16630fb68aed0a766a3ec693d68e6afa40_cppui_modular256);
+                        constexpr static const typename scalar_field_type::value_type glv_lambda =
+                            typename scalar_field_type::value_type(
+                                0xac9c52b33fa3cf1f5ad9e3fd77ed9ba4a880b9fc8ec739c2e0cfc810b51283ce_cppui_modular256);
+                        constexpr static const typename scalar_field_type::value_type glv_minus_b1 =
+                            typename scalar_field_type::value_type(0x3086d221a7d46bcde86c90e49284eb15_cppui_modular256);
+                        constexpr static const typename scalar_field_type::value_type glv_b2 =
+                            typename scalar_field_type::value_type(0x114ca50f7a8e2f3f657c1108d9d44cfd8_cppui_modular256);
+                        constexpr static const typename scalar_field_type::integral_type glv_g1 =
+                            0x114ca50f7a8e2f3f657c1108d9d44cfd9_cppui_modular256;
+                        constexpr static const typename scalar_field_type::integral_type glv_g2 =
+                            0x3086d221a7d46bcde86c90e49284eb15_cppui_modular256;
                     };
 
                     constexpr typename secp_k1_types<256>::base_field_type::value_type const
@@ -231,6 +248,18 @@ namespace nil {
                     constexpr std::array<
                         typename secp_k1_g1_params<256, forms::short_weierstrass>::field_type::value_type, 2> const
                         secp_k1_g1_params<256, forms::short_weierstrass>::one_fill;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::field_type::value_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_beta;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type::value_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_lambda;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type::value_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_minus_b1;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type::value_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_b2;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_g1;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_g2;
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
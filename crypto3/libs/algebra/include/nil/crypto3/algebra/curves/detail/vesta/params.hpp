@@ -76,6 +76,21 @@ namespace nil {
                         constexpr static std::array<typename field_type::value_type, 2> one_fill = {
                             field_type::modulus - 1,
                             typename field_type::value_type(2u)};
+
+                        /* GLV endomorphism (x, y) -> (glv_beta * x, y), which is the multiplication by glv_lambda,
+                         * and the constants of its scalar decomposition, see curves/detail/glv.hpp */
+                        constexpr static typename field_type::value_type glv_beta =
+                            typename field_type::value_type(0x397e65a7d7c1ad71aee24b27e308f0a61259527ec1d4752e619d1840af55f1b1_cppui_modular255);
+                        constexpr static typename scalar_field_type::value_type glv_lambda =
+                            typename scalar_field_type::value_type(0x2d33357cb532458ed3552a23a8554e5005270d29d19fc7d27b7fd22f0201b547_cppui_modular255);
+                        constexpr static typename scalar_field_type::value_type glv_minus_b1 =
+                            typename scalar_field_type::value_type(0x49e69d1640f049157fcae1c700000000_cppui_modular255);
+                        constexpr static typename scalar_field_type::value_type glv_b2 =
+                            typename scalar_field_type::value_type(0x49e69d1640a899538cb1279300000001_cppui_modular255);
+                        constexpr static typename scalar_field_type::integral_type glv_g1 =
+                            0x93cd3a2c815132a719624f2600000002_cppui_modular255;
+                        constexpr static typename scalar_field_type::integral_type glv_g2 =
+                            0x93cd3a2c81e0922aff95c38e00000000_cppui_modular255;
 #endif
                     };
 
@@ -88,6 +103,18 @@ namespace nil {
                         vesta_g1_params<forms::short_weierstrass>::zero_fill;
                     constexpr std::array<typename vesta_g1_params<forms::short_weierstrass>::field_type::value_type, 2>
                         vesta_g1_params<forms::short_weierstrass>::one_fill;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::field_type::value_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_beta;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_lambda;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_minus_b1;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_b2;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_g1;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_g2;
 #endif
 
                 }    // namespace detail
@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_ACCUMULATOR_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_ACCUMULATOR_HPP
+
+#include <iterator>
+#include <type_traits>
+
+#include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /**
+                     * Computes sums of products of field elements, like inner products and linear combinations.
+                     * This version reduces after every operation, the specialization for the prime fields
+                     * below keeps the sum unreduced.
+                     */
+                    template<typename ValueType, typename Enable = void>
+                    class element_accumulator {
+                    public:
+                        typedef ValueType value_type;
+
+                        constexpr element_accumulator() : m_sum(value_type::zero()) {
+                        }
+
+                        constexpr void multiply_add(const value_type &a, const value_type &b) {
+                            m_sum += a * b;
+                        }
+
+                        constexpr void add(const value_type &a) {
+                            m_sum += a;
+                        }
+
+                        constexpr value_type reduce() const {
+                            return m_sum;
+                        }
+
+                    private:
+                        value_type m_sum;
+                    };
+
+#ifndef __ZKLLVM__
+                    /**
+                     * Over cpp_int_modular backends the products are added as double-width integers, and the
+                     * Montgomery reduction is done once in reduce(), so a sum of n products costs about n
+                     * multiplications of integers and a single modular multiplication.
+                     * Up to 2^64 products and values may be added.
+                     */
+                    template<typename FieldParams>
+                    class element_accumulator<
+                        element_fp<FieldParams>,
+                        typename std::enable_if<!boost::multiprecision::backends::is_trivial_cpp_int_modular<
+                            typename FieldParams::modular_backend>::value>::type> {
+                    public:
+                        typedef element_fp<FieldParams> value_type;
+
+                    private:
+                        typedef typename value_type::modular_type::backend_type modular_adaptor_type;
+                        typedef typename modular_adaptor_type::accumulator_type accumulator_type;
+
+                    public:
+                        constexpr element_accumulator() : m_accum(boost::multiprecision::limb_type(0u)) {
+                        }
+
+                        constexpr void multiply_add(const value_type &a, const value_type &b) {
+                            boost::multiprecision::backends::eval_multiply_accumulate(m_accum, a.data.backend(),
+                                                                                      b.data.backend());
+                        }
+
+                        constexpr void add(const value_type &a) {
+                            boost::multiprecision::backends::eval_add_accumulate(m_accum, a.data.backend());
+                        }
+
+                        constexpr value_type reduce() const {
+                            value_type result = value_type::zero();
+                            accumulator_type accum = m_accum;
+                            boost::multiprecision::backends::eval_reduce_accumulator(result.data.backend(), accum);
+                            return result;
+                        }
+
+                    private:
+                        accumulator_type m_accum;
+                    };
+#endif
+
+                    // Returns the sum of a[i] * b[i] for the elements of [first1, last1) and the ones starting at
+                    // first2, with a single reduction for the prime fields.
+                    template<typename InputIt1, typename InputIt2>
+                    typename std::iterator_traits<InputIt1>::value_type inner_product(InputIt1 first1, InputIt1 last1,
+                                                                                      InputIt2 first2) {
+                        element_accumulator<typename std::iterator_traits<InputIt1>::value_type> accum;
+                        for (; first1 != last1; ++first1, ++first2) {
+                            accum.multiply_add(*first1, *first2);
+                        }
+                        return accum.reduce();
+                    }
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_ELEMENT_ACCUMULATOR_HPP
@@ -27,6 +27,7 @@
 #define CRYPTO3_ALGEBRA_FIELDS_FP3_EXTENSION_HPP
 
 #include <nil/crypto3/algebra/fields/detail/element/fp3.hpp>
+#include <nil/crypto3/algebra/fields/detail/extension_params/goldilocks64/fp3.hpp>
 #include <nil/crypto3/algebra/fields/detail/extension_params/mnt6/fp3.hpp>
 
 #include <nil/crypto3/algebra/fields/params.hpp>
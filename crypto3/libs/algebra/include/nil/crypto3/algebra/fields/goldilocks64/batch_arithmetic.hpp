@@ -0,0 +1,132 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_BATCH_ARITHMETIC_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_BATCH_ARITHMETIC_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/modular/goldilocks64_arithmetic.hpp>
+
+#include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
+
+#ifndef __ZKLLVM__
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                /**
+                 * Element-wise kernels over arrays of goldilocks64 elements. Element operators go through
+                 * the generic multiprecision interface for every single value, these functions work on the
+                 * Montgomery form words directly and have branch-free loop bodies, so the compiler is able to
+                 * unroll and vectorize them. Results are the same as of the element operators.
+                 */
+                namespace detail {
+                    typedef goldilocks64_base_field::value_type goldilocks64_value_type;
+
+                    inline std::uint64_t goldilocks64_word(const goldilocks64_value_type &x) {
+                        return *x.data.backend().base_data().limbs();
+                    }
+
+                    inline void set_goldilocks64_word(goldilocks64_value_type &x, std::uint64_t w) {
+                        *x.data.backend().base_data().limbs() = w;
+                    }
+                }    // namespace detail
+
+                // a[i] += b[i]
+                inline void batch_add(goldilocks64_base_field::value_type *a,
+                                      const goldilocks64_base_field::value_type *b, std::size_t n) {
+                    namespace gl = boost::multiprecision::backends::goldilocks64;
+                    for (std::size_t i = 0; i < n; ++i) {
+                        detail::set_goldilocks64_word(
+                            a[i], gl::add(detail::goldilocks64_word(a[i]), detail::goldilocks64_word(b[i])));
+                    }
+                }
+
+                // a[i] -= b[i]
+                inline void batch_sub(goldilocks64_base_field::value_type *a,
+                                      const goldilocks64_base_field::value_type *b, std::size_t n) {
+                    namespace gl = boost::multiprecision::backends::goldilocks64;
+                    for (std::size_t i = 0; i < n; ++i) {
+                        detail::set_goldilocks64_word(
+                            a[i], gl::sub(detail::goldilocks64_word(a[i]), detail::goldilocks64_word(b[i])));
+                    }
+                }
+
+                // a[i] *= b[i]
+                inline void batch_mul(goldilocks64_base_field::value_type *a,
+                                      const goldilocks64_base_field::value_type *b, std::size_t n) {
+                    namespace gl = boost::multiprecision::backends::goldilocks64;
+                    for (std::size_t i = 0; i < n; ++i) {
+                        detail::set_goldilocks64_word(
+                            a[i], gl::montgomery_mul(detail::goldilocks64_word(a[i]), detail::goldilocks64_word(b[i])));
+                    }
+                }
+
+                // a[i] *= b
+                inline void batch_mul(goldilocks64_base_field::value_type *a,
+                                      const goldilocks64_base_field::value_type &b, std::size_t n) {
+                    namespace gl = boost::multiprecision::backends::goldilocks64;
+                    const std::uint64_t b_word = detail::goldilocks64_word(b);
+                    for (std::size_t i = 0; i < n; ++i) {
+                        detail::set_goldilocks64_word(a[i], gl::montgomery_mul(detail::goldilocks64_word(a[i]), b_word));
+                    }
+                }
+
+                inline void batch_add(std::vector<goldilocks64_base_field::value_type> &a,
+                                      const std::vector<goldilocks64_base_field::value_type> &b) {
+                    BOOST_ASSERT(a.size() == b.size());
+                    batch_add(a.data(), b.data(), a.size());
+                }
+
+                inline void batch_sub(std::vector<goldilocks64_base_field::value_type> &a,
+                                      const std::vector<goldilocks64_base_field::value_type> &b) {
+                    BOOST_ASSERT(a.size() == b.size());
+                    batch_sub(a.data(), b.data(), a.size());
+                }
+
+                inline void batch_mul(std::vector<goldilocks64_base_field::value_type> &a,
+                                      const std::vector<goldilocks64_base_field::value_type> &b) {
+                    BOOST_ASSERT(a.size() == b.size());
+                    batch_mul(a.data(), b.data(), a.size());
+                }
+
+                inline void batch_mul(std::vector<goldilocks64_base_field::value_type> &a,
+                                      const goldilocks64_base_field::value_type &b) {
+                    batch_mul(a.data(), b, a.size());
+                }
+            }    // namespace fields
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // __ZKLLVM__
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_BATCH_ARITHMETIC_HPP
@@ -33,6 +33,7 @@
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
 #include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -95,6 +96,8 @@ namespace nil {
                  * When compiled with USE_MIXED_ADDITION, assumes input is in special form.
                  * Requires that base_value_type implements .dbl() (and, if USE_MIXED_ADDITION is defined,
                  * .to_projective(), .mixed_add(), and batch_to_projective()).
+                 * On the curves with the GLV endomorphism the exponents are split in halves first, see
+                 * curves/detail/glv.hpp.
                  */
                 struct multiexp_method_BDLO12 {
                     template<typename InputBaseIterator, typename InputFieldIterator>
@@ -105,11 +108,51 @@ namespace nil {
                                 InputFieldIterator exponents_end) {
 
                         typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
-                        typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
 
                         std::size_t length = std::distance(bases, bases_end);
                         assert(length == std::distance(exponents, exponents_end));
 
+                        if constexpr (curves::detail::has_glv_endomorphism<base_value_type>::value) {
+                            // Every term k * P is split into k1 * P + k2 * glv_endomorphism(P), twice as many terms
+                            // with half as many windows.
+                            typedef typename base_value_type::params_type params_type;
+                            typedef typename params_type::scalar_field_type::integral_type integral_type;
+
+                            std::vector<base_value_type> glv_bases(2 * length);
+                            std::vector<integral_type> glv_exponents(2 * length);
+                            for (std::size_t i = 0; i < length; i++) {
+                                auto decomposition = curves::detail::glv_decompose<params_type>(exponents[i]);
+                                glv_bases[2 * i] = decomposition.k1_negative ? -bases[i] : bases[i];
+                                glv_bases[2 * i + 1] = curves::detail::glv_endomorphism(
+                                    decomposition.k2_negative ? -bases[i] : bases[i]);
+                                glv_exponents[2 * i] = decomposition.k1;
+                                glv_exponents[2 * i + 1] = decomposition.k2;
+                            }
+                            return process_exponents(glv_bases.begin(), glv_exponents.begin(), 2 * length);
+                        } else {
+                            return process_exponents(bases, exponents, length);
+                        }
+                    }
+
+                private:
+                    template<typename FieldValueType>
+                    static inline const typename FieldValueType::data_type &exponent_data(const FieldValueType &exponent) {
+                        return exponent.data;
+                    }
+
+                    template<typename Backend, boost::multiprecision::expression_template_option ExpressionTemplates>
+                    static inline const boost::multiprecision::number<Backend, ExpressionTemplates> &
+                        exponent_data(const boost::multiprecision::number<Backend, ExpressionTemplates> &exponent) {
+                        return exponent;
+                    }
+
+                    // The exponents are either field elements or integers.
+                    template<typename InputBaseIterator, typename InputExponentIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process_exponents(InputBaseIterator bases, InputExponentIterator exponents, std::size_t length) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+
                         // empirically, this seems to be a decent estimate of the optimal value of c
                         std::size_t log2_length = std::log2(length);
                         std::size_t c = log2_length - (log2_length / 3 - 2);
@@ -121,8 +164,8 @@ namespace nil {
                             // std::size_t bn_exponents_i_msb = boost::multiprecision::msb(exponents[i].data) + 1;
                             // But boost::multiprecision::msb doesn't work for zero value
                             std::size_t bn_exponents_i_msb = 1;
-                            if (exponents[i] != field_value_type::zero()) {
-                                bn_exponents_i_msb = boost::multiprecision::msb(exponents[i].data) + 1;
+                            if (!exponents[i].is_zero()) {
+                                bn_exponents_i_msb = boost::multiprecision::msb(exponent_data(exponents[i])) + 1;
                             }
                             num_bits = std::max(num_bits, bn_exponents_i_msb);
                         }
@@ -145,7 +188,7 @@ namespace nil {
                             for (std::size_t i = 0; i < length; i++) {
                                 std::size_t id = 0;
                                 for (std::size_t j = 0; j < c; j++) {
-                                    if (boost::multiprecision::bit_test(exponents[i].data, k * c + j)) {
+                                    if (boost::multiprecision::bit_test(exponent_data(exponents[i]), k * c + j)) {
                                         id |= 1 << j;
                                     }
                                 }
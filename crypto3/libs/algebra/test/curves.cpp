@@ -58,6 +58,8 @@
 #include <nil/crypto3/algebra/fields/fp2.hpp>
 #include <nil/crypto3/algebra/fields/fp3.hpp>
 
+#include <nil/crypto3/algebra/random_element.hpp>
+
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
 using namespace nil::crypto3::algebra;
@@ -665,4 +667,58 @@ BOOST_AUTO_TEST_CASE(twisted_edwards_extended_order_test) {
     BOOST_CHECK_EQUAL(check, g1_type::value_type::zero());
 }
 
+/*
+ * GLV scalar multiplication by field elements, compared with the multiplication by the same integers
+ */
+template<typename group_type>
+class glv_runner {
+    using point_type = typename group_type::value_type;
+    using params_type = typename point_type::params_type;
+    using scalar_field_type = typename params_type::scalar_field_type;
+    using scalar_type = typename scalar_field_type::value_type;
+    using integral_type = typename scalar_field_type::integral_type;
+
+    static_assert(curves::detail::has_glv_endomorphism<point_type>::value, "The curve has no GLV endomorphism");
+
+    static point_type integral_mul(point_type point, const scalar_type &scalar) {
+        curves::detail::scalar_mul_inplace(point, static_cast<integral_type>(scalar.data));
+        return point;
+    }
+
+    public:
+    bool static run() {
+        point_type p = random_element<group_type>();
+
+        BOOST_CHECK_EQUAL(curves::detail::glv_endomorphism(p), integral_mul(p, params_type::glv_lambda));
+
+        std::vector<scalar_type> scalars = {
+            scalar_type::zero(), scalar_type::one(), -scalar_type::one(), params_type::glv_lambda,
+            -params_type::glv_lambda, params_type::glv_minus_b1, params_type::glv_b2,
+            scalar_type(scalar_field_type::modulus / 2u)};
+        for (std::size_t i = 0; i < 32; ++i) {
+            scalars.push_back(random_element<scalar_field_type>());
+        }
+
+        bool result = true;
+        for (const scalar_type &k : scalars) {
+            point_type expected = integral_mul(p, k);
+            BOOST_CHECK_EQUAL(p * k, expected);
+            BOOST_CHECK_EQUAL(point_type::zero() * k, point_type::zero());
+            result = result && (p * k == expected);
+        }
+        return result;
+    }
+};
+
+using glv_runners = boost::mpl::list<
+    glv_runner<curves::pallas::g1_type<>>,
+    glv_runner<curves::vesta::g1_type<>>,
+    glv_runner<curves::secp_k1<256>::g1_type<>>,
+    glv_runner<curves::bls12_381::g1_type<>>,
+    glv_runner<curves::bls12_381::g1_type<curves::coordinates::projective>>>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(glv_scalar_mul_test, runner, glv_runners) {
+    BOOST_CHECK(runner::run());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
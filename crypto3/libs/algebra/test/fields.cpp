@@ -28,6 +28,9 @@
 
 #include <iostream>
 #include <string>
+#include <cstdint>
+#include <random>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -58,9 +61,11 @@
 #include <nil/crypto3/algebra/fields/curve25519/base_field.hpp>
 #include <nil/crypto3/algebra/fields/curve25519/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/batch_arithmetic.hpp>
 
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/fp2.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/accumulator.hpp>
 
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/mnt6.hpp>
@@ -70,6 +75,8 @@
 #include <nil/crypto3/algebra/curves/secp_k1.hpp>
 #include <nil/crypto3/algebra/curves/secp_r1.hpp>
 
+#include <nil/crypto3/algebra/random_element.hpp>
+
 using namespace nil::crypto3::algebra;
 
 namespace boost {
@@ -354,6 +361,148 @@ BOOST_DATA_TEST_CASE(field_operation_test_goldilocks64_fq, string_data("field_op
     field_operation_test<policy_type>(data_set);
 }
 
+// Reference arithmetic modulo the Goldilocks prime on plain words, independent of the field implementation.
+namespace goldilocks64_reference {
+    constexpr std::uint64_t modulus = 0xFFFFFFFF00000001ULL;
+
+    std::uint64_t add(std::uint64_t a, std::uint64_t b) {
+        return a >= modulus - b ? a - (modulus - b) : a + b;
+    }
+
+    std::uint64_t sub(std::uint64_t a, std::uint64_t b) {
+        return a >= b ? a - b : a + (modulus - b);
+    }
+
+    // Double-and-add, so that no 128-bit type is needed.
+    std::uint64_t mul(std::uint64_t a, std::uint64_t b) {
+        std::uint64_t result = 0;
+        for (int bit = 63; bit >= 0; --bit) {
+            result = add(result, result);
+            if ((b >> bit) & 1u) {
+                result = add(result, a);
+            }
+        }
+        return result;
+    }
+}    // namespace goldilocks64_reference
+
+BOOST_AUTO_TEST_CASE(field_batch_operation_test_goldilocks64_fq) {
+    using value_type = fields::goldilocks64_fq::value_type;
+    using integral_type = fields::goldilocks64_fq::integral_type;
+    namespace reference = goldilocks64_reference;
+
+    // Includes the values next to 0, 2^32 and the modulus, where the special form reduction has corner cases.
+    std::vector<std::uint64_t> a_words = {
+        0u, 1u, 2u, 0xFFFFFFFFu, 0x100000000u, 0xFFFFFFFF00000000u, 0xFFFFFFFEFFFFFFFFu};
+    std::vector<std::uint64_t> b_words = {
+        0xFFFFFFFF00000000u, 0xFFFFFFFF00000000u, 0x100000000u, 0xFFFFFFFFu, 0u, 1u, 7u};
+    std::mt19937_64 generator(0x5EED);
+    for (std::size_t i = 0; i < 100; ++i) {
+        a_words.push_back(generator() % reference::modulus);
+        b_words.push_back(generator() % reference::modulus);
+    }
+    const std::uint64_t y_word = generator() % reference::modulus;
+
+    const auto to_field = [](std::uint64_t word) {
+        return value_type(integral_type(word));
+    };
+    std::vector<value_type> a, b;
+    for (std::size_t i = 0; i < a_words.size(); ++i) {
+        a.push_back(to_field(a_words[i]));
+        b.push_back(to_field(b_words[i]));
+    }
+    const value_type y = to_field(y_word);
+
+    std::vector<value_type> sum = a, difference = a, product = a, scaled = a;
+    fields::batch_add(sum, b);
+    fields::batch_sub(difference, b);
+    fields::batch_mul(product, b);
+    fields::batch_mul(scaled, y);
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        const value_type expected_sum = to_field(reference::add(a_words[i], b_words[i]));
+        const value_type expected_difference = to_field(reference::sub(a_words[i], b_words[i]));
+        const value_type expected_product = to_field(reference::mul(a_words[i], b_words[i]));
+        const value_type expected_scaled = to_field(reference::mul(a_words[i], y_word));
+
+        // Both the batch kernels and the element operators use the special form reduction.
+        BOOST_CHECK_EQUAL(sum[i], expected_sum);
+        BOOST_CHECK_EQUAL(difference[i], expected_difference);
+        BOOST_CHECK_EQUAL(product[i], expected_product);
+        BOOST_CHECK_EQUAL(scaled[i], expected_scaled);
+        BOOST_CHECK_EQUAL(a[i] + b[i], expected_sum);
+        BOOST_CHECK_EQUAL(a[i] - b[i], expected_difference);
+        BOOST_CHECK_EQUAL(a[i] * b[i], expected_product);
+    }
+}
+
+template<typename FieldType>
+void field_extension_properties_test() {
+    using value_type = typename FieldType::value_type;
+    using underlying_type = typename value_type::underlying_type;
+
+    for (std::size_t i = 0; i < 10; ++i) {
+        value_type a = random_element<FieldType>();
+        value_type b = random_element<FieldType>();
+
+        BOOST_CHECK_EQUAL(a * b, b * a);
+        BOOST_CHECK_EQUAL((a * b) * b.inversed(), a);
+        BOOST_CHECK_EQUAL(a.squared(), a * a);
+        BOOST_CHECK_EQUAL(a.doubled(), a + a);
+        BOOST_CHECK_EQUAL(a - a, value_type::zero());
+        BOOST_CHECK_EQUAL(a.pow(5u), a * a * a * a * a);
+        BOOST_CHECK(a.squared().is_square());
+        BOOST_CHECK_EQUAL(a.squared().sqrt().squared(), a.squared());
+        // The Frobenius map is x -> x^p.
+        BOOST_CHECK_EQUAL(a.Frobenius_map(1u), a.pow(FieldType::modulus));
+        BOOST_CHECK_EQUAL(underlying_type(3u) * a, a + a + a);
+    }
+
+    value_type nqr(typename value_type::data_type{});
+    for (std::size_t i = 0; i < nqr.data.size(); ++i) {
+        nqr.data[i] = underlying_type(FieldType::extension_policy::nqr[i]);
+    }
+    BOOST_CHECK(!nqr.is_square());
+}
+
+BOOST_AUTO_TEST_CASE(field_extension_test_goldilocks64) {
+    field_extension_properties_test<fields::fp2<fields::goldilocks64_fq>>();
+    field_extension_properties_test<fields::fp3<fields::goldilocks64_fq>>();
+}
+
+template<typename FieldType>
+void field_accumulator_test() {
+    using value_type = typename FieldType::value_type;
+
+    for (std::size_t n : {1, 2, 3, 16, 1000}) {
+        std::vector<value_type> a(n), b(n);
+        value_type expected = value_type::zero(), expected_with_sum = value_type::zero();
+        value_type expected_sum = value_type::zero();
+        fields::detail::element_accumulator<value_type> accum, sum_accum;
+        for (std::size_t i = 0; i < n; ++i) {
+            // The largest elements give the largest products to accumulate.
+            a[i] = i % 2 ? -value_type::one() : random_element<FieldType>();
+            b[i] = i % 3 ? -value_type::one() : random_element<FieldType>();
+            expected += a[i] * b[i];
+            expected_with_sum += a[i] * b[i] + a[i];
+            expected_sum += a[i];
+            accum.multiply_add(a[i], b[i]);
+            accum.add(a[i]);
+            sum_accum.add(a[i]);
+        }
+        BOOST_CHECK_EQUAL(fields::detail::inner_product(a.begin(), a.end(), b.begin()), expected);
+        BOOST_CHECK_EQUAL(accum.reduce(), expected_with_sum);
+        BOOST_CHECK_EQUAL(sum_accum.reduce(), expected_sum);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(field_accumulator_test_all) {
+    field_accumulator_test<fields::pallas_base_field>();
+    field_accumulator_test<fields::secp_k1_base_field<256>>();
+    field_accumulator_test<fields::bls12_fq<381>>();
+    field_accumulator_test<fields::goldilocks64_fq>();
+}
+
 BOOST_DATA_TEST_CASE(field_operation_test_bls12_381_fr, string_data("field_operation_test_bls12_381_fr"), data_set) {
     using policy_type = fields::bls12_fr<381>;
 
@@ -479,6 +479,21 @@ namespace nil {
                     return accumulators::extract::hash<T>(acc);
                 }
 
+                // Appends the rows above the leaves, the leaves must be already in the tree.
+                template<typename T, std::size_t Arity>
+                void hash_inner_rows(merkle_tree_impl<T, Arity> &tree) {
+                    typedef typename T::hash_type hash_type;
+
+                    std::size_t row_idx = tree.leaves(), row_size = row_idx / Arity;
+                    typename merkle_tree_impl<T, Arity>::iterator it = tree.begin();
+
+                    for (size_t row_number = 1; row_number < tree.row_count(); ++row_number, row_size /= Arity) {
+                        for (size_t i = 0; i < row_size; ++i, it += Arity) {
+                            tree.emplace_back(generate_hash<hash_type>(it, it + Arity));
+                        }
+                    }
+                }
+
                 template<typename T, std::size_t Arity, typename LeafIterator>
                 merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
                     typedef T node_type;
@@ -491,14 +506,19 @@ namespace nil {
                         ret.emplace_back(crypto3::hash<hash_type>(*first++));
                     }
 
-                    std::size_t row_idx = ret.leaves(), row_size = row_idx / Arity;
-                    typename merkle_tree_impl<T, Arity>::iterator it = ret.begin();
+                    hash_inner_rows(ret);
+                    return ret;
+                }
 
-                    for (size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
-                        for (size_t i = 0; i < row_size; ++i, it += Arity) {
-                            ret.emplace_back(generate_hash<hash_type>(it, it + Arity));
-                        }
-                    }
+                template<typename T, std::size_t Arity, typename LeafHasher>
+                merkle_tree_impl<T, Arity> make_merkle_tree(std::size_t leaves_number, const LeafHasher &hash_leaves) {
+                    merkle_tree_impl<T, Arity> ret(leaves_number);
+                    ret.reserve(ret.complete_size());
+                    ret.resize(leaves_number);
+
+                    hash_leaves(std::size_t(0), leaves_number, ret.begin());
+
+                    hash_inner_rows(ret);
                     return ret;
                 }
             }    // namespace detail
@@ -516,6 +536,19 @@ namespace nil {
                         Arity>(first, last);
             }
 
+            /**
+             * Builds the tree without keeping all the leaves in memory: hash_leaves(begin, end, out) must write
+             * the digests of the leaves [begin, end) to the iterator 'out'. It is called on disjoint ranges,
+             * possibly in parallel, so the caller only needs scratch space for the leaves of one range.
+             */
+            template<typename T, std::size_t Arity, typename LeafHasher>
+            merkle_tree<T, Arity> make_merkle_tree(std::size_t leaves_number, const LeafHasher &hash_leaves) {
+                return detail::make_merkle_tree<typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                        detail::merkle_tree_node<T>,
+                        T>::type,
+                        Arity>(leaves_number, hash_leaves);
+            }
+
         }    // namespace containers
     }        // namespace crypto3
 }    // namespace nil
@@ -284,6 +284,19 @@ BOOST_AUTO_TEST_CASE(merkletree_construct_test_2) {
 }
 
 
+BOOST_AUTO_TEST_CASE(merkletree_leaf_hasher_test) {
+    std::vector<std::array<char, 1>> v = {{'0'}, {'1'}, {'2'}, {'3'}, {'4'}, {'5'}, {'6'}, {'7'}, {'8'}};
+    auto expected = make_merkle_tree<hashes::sha2<256>, 3>(v.begin(), v.end());
+    auto tree = make_merkle_tree<hashes::sha2<256>, 3>(v.size(), [&v](std::size_t begin, std::size_t end, auto out) {
+        for (std::size_t i = begin; i < end; ++i, ++out) {
+            *out = static_cast<typename hashes::sha2<256>::digest_type>(hash<hashes::sha2<256>>(v[i]));
+        }
+    });
+    BOOST_CHECK_EQUAL(tree.size(), expected.size());
+    BOOST_CHECK(tree == expected);
+    BOOST_CHECK(tree.root() == expected.root());
+}
+
 BOOST_AUTO_TEST_CASE(merkletree_validate_test_1) {
     std::vector<std::array<char, 1>> v = {{'0'}, {'1'}, {'2'}, {'3'}, {'4'}, {'5'}, {'6'}, {'7'}};
     testing_validate_template<hashes::sha2<256>, 2>(v);
@@ -0,0 +1,88 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_BATCH_HPP
+#define CRYPTO3_HASH_BATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/type_traits.hpp>
+#include <nil/crypto3/hash/detail/keccak/keccak_multi_buffer.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_multi_state.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        /*!
+         * @brief Hashes 'count' messages of 'length' bytes each, digests[i] being the digest of messages[i].
+         *
+         * Gives the same digests as hash<Hash> called on every message. Keccak hashes several messages at
+         * once with SIMD if the CPU supports it, other hashes process them one by one.
+         *
+         * @ingroup hash_algorithms
+         */
+        template<typename Hash>
+        void hash_batch(const std::uint8_t *const *messages, std::size_t length, std::size_t count,
+                        typename Hash::digest_type *digests) {
+            if constexpr (hashes::is_keccak_1600<Hash>::value) {
+                hashes::detail::keccak_1600_multi_buffer<typename Hash::policy_type>::hash(messages, length, count,
+                                                                                           digests);
+            } else {
+                for (std::size_t i = 0; i < count; ++i) {
+                    digests[i] = hash<Hash>(messages[i], messages[i] + length);
+                }
+            }
+        }
+
+        /*!
+         * @brief Hashes 'count' messages of 'length' field elements each, digests[i] being the digest of messages[i].
+         *
+         * Gives the same digests as hash<Hash> called on every message. Poseidon runs the permutations of
+         * several messages together, other algebraic hashes process them one by one.
+         *
+         * @ingroup hash_algorithms
+         */
+        template<typename Hash>
+        typename std::enable_if<algebra::is_field_element<typename Hash::word_type>::value>::type
+            hash_batch(const typename Hash::word_type *const *messages, std::size_t length, std::size_t count,
+                       typename Hash::digest_type *digests) {
+            if constexpr (hashes::is_poseidon<Hash>::value) {
+                hashes::detail::poseidon_multi_state<typename Hash::policy_type>::hash(messages, length, count,
+                                                                                       digests);
+            } else {
+                for (std::size_t i = 0; i < count; ++i) {
+                    digests[i] = hash<Hash>(messages[i], messages[i] + length);
+                }
+            }
+        }
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_BATCH_HPP
@@ -0,0 +1,245 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_KECCAK_MULTI_BUFFER_HPP
+#define CRYPTO3_KECCAK_MULTI_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <boost/config.hpp>
+
+#include <nil/crypto3/hash/detail/keccak/keccak_policy.hpp>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CRYPTO3_KECCAK_MULTI_BUFFER_X86
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Keccak over many independent messages of the same length.
+                 *
+                 * Word i of the states of several messages is kept in one vector, so every operation of the
+                 * permutation processes 8 messages with AVX-512 or 4 with AVX2. The instruction set is picked at
+                 * run time, messages which do not fill a whole vector, or all of them on other CPUs, are hashed
+                 * one by one with the same code over 64-bit words.
+                 */
+                template<typename PolicyType>
+                struct keccak_1600_multi_buffer {
+                    typedef PolicyType policy_type;
+
+                    typedef typename policy_type::word_type word_type;
+                    typedef typename policy_type::digest_type digest_type;
+
+                    constexpr static const std::size_t state_words = policy_type::state_words;
+                    constexpr static const std::size_t rate_bytes = policy_type::block_bits / 8;
+                    constexpr static const std::size_t rate_words = policy_type::block_words;
+                    constexpr static const std::size_t digest_bytes = policy_type::digest_bits / 8;
+                    constexpr static const std::size_t digest_words = (digest_bytes + 7) / 8;
+
+                    // digests[i] receives the digest of the 'length' bytes starting at messages[i].
+                    static void hash(const std::uint8_t *const *messages, std::size_t length, std::size_t count,
+                                     digest_type *digests) {
+                        std::size_t i = 0;
+#ifdef CRYPTO3_KECCAK_MULTI_BUFFER_X86
+                        if (__builtin_cpu_supports("avx512f")) {
+                            for (; i + 8 <= count; i += 8) {
+                                hash_avx512(messages + i, length, digests + i);
+                            }
+                        }
+                        if (__builtin_cpu_supports("avx2")) {
+                            for (; i + 4 <= count; i += 4) {
+                                hash_avx2(messages + i, length, digests + i);
+                            }
+                        }
+#endif
+                        for (; i < count; ++i) {
+                            hash_lanes<word_type, 1>(messages + i, length, digests + i);
+                        }
+                    }
+
+                private:
+#ifdef CRYPTO3_KECCAK_MULTI_BUFFER_X86
+                    typedef word_type avx2_vector_type __attribute__((vector_size(32)));
+                    typedef word_type avx512_vector_type __attribute__((vector_size(64)));
+
+                    __attribute__((target("avx2"))) static void
+                        hash_avx2(const std::uint8_t *const *messages, std::size_t length, digest_type *digests) {
+                        hash_lanes<avx2_vector_type, 4>(messages, length, digests);
+                    }
+
+                    __attribute__((target("avx512f"))) static void
+                        hash_avx512(const std::uint8_t *const *messages, std::size_t length, digest_type *digests) {
+                        hash_lanes<avx512_vector_type, 8>(messages, length, digests);
+                    }
+#endif
+
+                    // Everything below is force-inlined, so it is compiled for the instruction set of the caller.
+
+                    static BOOST_FORCEINLINE word_type load_word(const std::uint8_t *bytes) {
+                        word_type result = 0;
+                        for (std::size_t i = 8; i > 0; --i) {
+                            result = (result << 8) | bytes[i - 1];
+                        }
+                        return result;
+                    }
+
+                    template<typename VectorType, std::size_t Lanes>
+                    static BOOST_FORCEINLINE void absorb(VectorType *state, const std::uint8_t *const *blocks) {
+                        for (std::size_t w = 0; w < rate_words; ++w) {
+                            word_type words[Lanes];
+                            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                                words[lane] = load_word(blocks[lane] + 8 * w);
+                            }
+                            VectorType block_word;
+                            std::memcpy(&block_word, words, sizeof(block_word));
+                            state[w] ^= block_word;
+                        }
+                    }
+
+                    template<typename VectorType, std::size_t Lanes>
+                    static BOOST_FORCEINLINE void hash_lanes(const std::uint8_t *const *messages, std::size_t length,
+                                                             digest_type *digests) {
+                        VectorType state[state_words];
+                        std::memset(state, 0, sizeof(state));
+
+                        const std::uint8_t *blocks[Lanes];
+                        std::size_t offset = 0;
+                        for (; offset + rate_bytes <= length; offset += rate_bytes) {
+                            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                                blocks[lane] = messages[lane] + offset;
+                            }
+                            absorb<VectorType, Lanes>(state, blocks);
+                            permute(state);
+                        }
+
+                        // pad10*1 with the Keccak domain bit, the same as keccak_1600_padder.
+                        std::uint8_t last_blocks[Lanes][rate_bytes];
+                        std::memset(last_blocks, 0, sizeof(last_blocks));
+                        for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                            if (length > offset) {
+                                std::memcpy(last_blocks[lane], messages[lane] + offset, length - offset);
+                            }
+                            last_blocks[lane][length - offset] ^= 0x01;
+                            last_blocks[lane][rate_bytes - 1] ^= 0x80;
+                            blocks[lane] = last_blocks[lane];
+                        }
+                        absorb<VectorType, Lanes>(state, blocks);
+                        permute(state);
+
+                        for (std::size_t w = 0; w < digest_words; ++w) {
+                            word_type words[Lanes];
+                            std::memcpy(words, &state[w], sizeof(words));
+                            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                                for (std::size_t i = 0; i < 8 && 8 * w + i < digest_bytes; ++i) {
+                                    digests[lane][8 * w + i] = static_cast<std::uint8_t>(words[lane] >> (8 * i));
+                                }
+                            }
+                        }
+                    }
+
+                    template<int Shift, typename VectorType>
+                    static BOOST_FORCEINLINE void rotl(VectorType &result, const VectorType &x) {
+                        result = (x << Shift) | (x >> (64 - Shift));
+                    }
+
+                    // The same round as keccak_1600_impl::permute, over vectors of words.
+                    template<typename VectorType>
+                    static BOOST_FORCEINLINE void permute(VectorType *A) {
+                        static constexpr const word_type round_constants[] = {
+                            UINT64_C(0x0000000000000001), UINT64_C(0x0000000000008082), UINT64_C(0x800000000000808a),
+                            UINT64_C(0x8000000080008000), UINT64_C(0x000000000000808b), UINT64_C(0x0000000080000001),
+                            UINT64_C(0x8000000080008081), UINT64_C(0x8000000000008009), UINT64_C(0x000000000000008a),
+                            UINT64_C(0x0000000000000088), UINT64_C(0x0000000080008009), UINT64_C(0x000000008000000a),
+                            UINT64_C(0x000000008000808b), UINT64_C(0x800000000000008b), UINT64_C(0x8000000000008089),
+                            UINT64_C(0x8000000000008003), UINT64_C(0x8000000000008002), UINT64_C(0x8000000000000080),
+                            UINT64_C(0x000000000000800a), UINT64_C(0x800000008000000a), UINT64_C(0x8000000080008081),
+                            UINT64_C(0x8000000000008080), UINT64_C(0x0000000080000001), UINT64_C(0x8000000080008008)};
+
+                        for (word_type c : round_constants) {
+                            const VectorType C0 = A[0] ^ A[5] ^ A[10] ^ A[15] ^ A[20];
+                            const VectorType C1 = A[1] ^ A[6] ^ A[11] ^ A[16] ^ A[21];
+                            const VectorType C2 = A[2] ^ A[7] ^ A[12] ^ A[17] ^ A[22];
+                            const VectorType C3 = A[3] ^ A[8] ^ A[13] ^ A[18] ^ A[23];
+                            const VectorType C4 = A[4] ^ A[9] ^ A[14] ^ A[19] ^ A[24];
+
+                            VectorType D0, D1, D2, D3, D4;
+                            rotl<1>(D0, C0);
+                            rotl<1>(D1, C1);
+                            rotl<1>(D2, C2);
+                            rotl<1>(D3, C3);
+                            rotl<1>(D4, C4);
+                            D0 ^= C3;
+                            D1 ^= C4;
+                            D2 ^= C0;
+                            D3 ^= C1;
+                            D4 ^= C2;
+
+                            VectorType B[25];
+                            B[0] = A[0] ^ D1;
+                            rotl<1>(B[10], A[1] ^ D2);
+                            rotl<62>(B[20], A[2] ^ D3);
+                            rotl<28>(B[5], A[3] ^ D4);
+                            rotl<27>(B[15], A[4] ^ D0);
+                            rotl<36>(B[16], A[5] ^ D1);
+                            rotl<44>(B[1], A[6] ^ D2);
+                            rotl<6>(B[11], A[7] ^ D3);
+                            rotl<55>(B[21], A[8] ^ D4);
+                            rotl<20>(B[6], A[9] ^ D0);
+                            rotl<3>(B[7], A[10] ^ D1);
+                            rotl<10>(B[17], A[11] ^ D2);
+                            rotl<43>(B[2], A[12] ^ D3);
+                            rotl<25>(B[12], A[13] ^ D4);
+                            rotl<39>(B[22], A[14] ^ D0);
+                            rotl<41>(B[23], A[15] ^ D1);
+                            rotl<45>(B[8], A[16] ^ D2);
+                            rotl<15>(B[18], A[17] ^ D3);
+                            rotl<21>(B[3], A[18] ^ D4);
+                            rotl<8>(B[13], A[19] ^ D0);
+                            rotl<18>(B[14], A[20] ^ D1);
+                            rotl<2>(B[24], A[21] ^ D2);
+                            rotl<61>(B[9], A[22] ^ D3);
+                            rotl<56>(B[19], A[23] ^ D4);
+                            rotl<14>(B[4], A[24] ^ D0);
+
+                            for (std::size_t row = 0; row < 25; row += 5) {
+                                for (std::size_t x = 0; x < 5; ++x) {
+                                    A[row + x] = B[row + x] ^ (~B[row + (x + 1) % 5] & B[row + (x + 2) % 5]);
+                                }
+                            }
+                            A[0] ^= c;
+                        }
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_KECCAK_MULTI_BUFFER_HPP
@@ -16,6 +16,7 @@
 #include <nil/crypto3/algebra/vector/vector.hpp>
 #include <nil/crypto3/algebra/vector/math.hpp>
 #include <nil/crypto3/algebra/vector/operators.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/accumulator.hpp>
 
 #include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
 #include <nil/crypto3/hash/detail/poseidon/original_constants.hpp>
@@ -63,7 +64,20 @@ namespace nil {
                     }
 
                     inline void product_with_mds_matrix(state_vector_type &A_vector) const {
-                        A_vector = algebra::vectmatmul(A_vector, mds_matrix);
+                        product_with_matrix(A_vector, mds_matrix);
+                    }
+
+                    // Same as algebra::vectmatmul(A_vector, matrix), but each output word is reduced once.
+                    static inline void product_with_matrix(state_vector_type &A_vector, const mds_matrix_type &matrix) {
+                        state_vector_type result;
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            algebra::fields::detail::element_accumulator<element_type> accum;
+                            for (std::size_t j = 0; j < state_words; j++) {
+                                accum.multiply_add(A_vector[j], matrix[j][i]);
+                            }
+                            result[i] = accum.reduce();
+                        }
+                        A_vector = result;
                     }
 
                     mds_matrix_type mds_matrix;
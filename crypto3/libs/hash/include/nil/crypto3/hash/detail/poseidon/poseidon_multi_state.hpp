@@ -0,0 +1,155 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_POSEIDON_MULTI_STATE_HPP
+#define CRYPTO3_HASH_POSEIDON_MULTI_STATE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_permutation.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_round_operator.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Poseidon permutation of many independent states.
+                 *
+                 * Up to 'lanes' states are kept word by word, so every step of a round runs over all of them in
+                 * the innermost loop with the same constant, and the field multiplications of different states
+                 * do not depend on each other. Gives the same result as poseidon_permutation on every state.
+                 * Only the optimized form of the original version is batched, other policies permute the states
+                 * one by one.
+                 */
+                template<typename PolicyType>
+                struct poseidon_multi_state {
+                    typedef PolicyType policy_type;
+                    typedef poseidon_permutation<policy_type> permutation_type;
+
+                    typedef typename policy_type::word_type word_type;
+                    typedef typename policy_type::state_type state_type;
+                    typedef typename policy_type::digest_type digest_type;
+
+                    constexpr static const std::size_t state_words = policy_type::state_words;
+                    constexpr static const std::size_t full_rounds = policy_type::full_rounds;
+                    constexpr static const std::size_t half_full_rounds = policy_type::half_full_rounds;
+                    constexpr static const std::size_t part_rounds = policy_type::part_rounds;
+                    constexpr static const std::size_t sbox_power = policy_type::sbox_power;
+
+                    // Number of states which go through the rounds together.
+                    constexpr static const std::size_t lanes = 8;
+
+                    static void permute(state_type *states, std::size_t count) {
+                        if constexpr (policy_type::mina_version || !policy_type::optimized) {
+                            for (std::size_t i = 0; i < count; ++i) {
+                                permutation_type::permute(states[i]);
+                            }
+                        } else {
+                            for (std::size_t i = 0; i < count; i += lanes) {
+                                permute_lanes(states + i, std::min(lanes, count - i));
+                            }
+                        }
+                    }
+
+                    /*!
+                     * digests[i] receives the hashes::poseidon digest of the 'length' words starting at messages[i].
+                     * The sponge of hashes::poseidon absorbs into all the words of the state but the first one,
+                     * permutes whenever they are filled and once more for the digest, which is the last word.
+                     * After a permutation the last word is moved to the first one and the others are zeroed.
+                     */
+                    static void hash(const word_type *const *messages, std::size_t length, std::size_t count,
+                                     digest_type *digests) {
+                        std::array<state_type, lanes> states;
+                        for (std::size_t begin = 0; begin < count; begin += lanes) {
+                            const std::size_t n = std::min(lanes, count - begin);
+                            for (std::size_t k = 0; k < n; ++k) {
+                                states[k].fill(0u);
+                            }
+
+                            std::size_t position = 1;
+                            for (std::size_t j = 0; j < length; ++j) {
+                                if (position == state_words) {
+                                    permute(states.data(), n);
+                                    for (std::size_t k = 0; k < n; ++k) {
+                                        states[k][0] = states[k][state_words - 1];
+                                        std::fill(states[k].begin() + 1, states[k].end(), word_type(0u));
+                                    }
+                                    position = 1;
+                                }
+                                for (std::size_t k = 0; k < n; ++k) {
+                                    states[k][position] = messages[begin + k][j];
+                                }
+                                ++position;
+                            }
+
+                            permute(states.data(), n);
+                            for (std::size_t k = 0; k < n; ++k) {
+                                digests[begin + k] = states[k][state_words - 1];
+                            }
+                        }
+                    }
+
+                private:
+                    typedef poseidon_round_operator<policy_type> round_operator_type;
+                    typedef poseidon_optimized_constants<policy_type> constants_type;
+                    typedef typename constants_type::template lanes_state_type<lanes> lanes_state_type;
+
+                    // The same rounds as poseidon_round_operator for the optimized form, on 'count' <= lanes states.
+                    static void permute_lanes(state_type *states, std::size_t count) {
+                        const constants_type &constants = round_operator_type::get_constants();
+
+                        lanes_state_type A;
+                        for (std::size_t i = 0; i < state_words; ++i) {
+                            for (std::size_t k = 0; k < count; ++k) {
+                                A[i][k] = states[k][i];
+                            }
+                        }
+
+                        std::size_t round_number = 0;
+                        for (std::size_t r = 0; r < half_full_rounds; ++r) {
+                            full_round(A, count, constants, round_number++);
+                        }
+                        for (std::size_t r = 0; r < part_rounds; ++r) {
+                            for (std::size_t k = 0; k < count; ++k) {
+                                A[0][k] += constants.get_part_round_constant(round_number);
+                                A[0][k] = poseidon_sbox<sbox_power>(A[0][k]);
+                            }
+                            constants.product_with_part_round_matrix(A, count, round_number++);
+                        }
+                        for (std::size_t r = half_full_rounds; r < full_rounds; ++r) {
+                            full_round(A, count, constants, round_number++);
+                        }
+
+                        for (std::size_t i = 0; i < state_words; ++i) {
+                            for (std::size_t k = 0; k < count; ++k) {
+                                states[k][i] = A[i][k];
+                            }
+                        }
+                    }
+
+                    static void full_round(lanes_state_type &A, std::size_t count, const constants_type &constants,
+                                           std::size_t round_number) {
+                        for (std::size_t i = 0; i < state_words; ++i) {
+                            const word_type &round_constant = constants.get_full_round_constant(round_number, i);
+                            for (std::size_t k = 0; k < count; ++k) {
+                                A[i][k] = poseidon_sbox<sbox_power>(A[i][k] + round_constant);
+                            }
+                        }
+                        constants.product_with_mds_matrix(A, count);
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_POSEIDON_MULTI_STATE_HPP
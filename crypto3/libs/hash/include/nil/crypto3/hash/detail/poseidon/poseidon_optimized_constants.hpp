@@ -0,0 +1,285 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_POSEIDON_OPTIMIZED_CONSTANTS_HPP
+#define CRYPTO3_HASH_POSEIDON_OPTIMIZED_CONSTANTS_HPP
+
+#include <array>
+#include <utility>
+
+#include <nil/crypto3/algebra/fields/detail/element/accumulator.hpp>
+
+#include <nil/crypto3/hash/detail/poseidon/poseidon_constants.hpp>
+
+#include <boost/assert.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+
+                /*!
+                 * @brief Constants of the equivalent form of the original Poseidon from Appendix B of the paper.
+                 *
+                 * The S-box of a partial round changes the first word only, so the round constants of the other
+                 * words are moved through the MDS matrix into the next round, and all the partial rounds add a
+                 * single constant to the first word. What is left after the last partial round is added to the
+                 * constants of the following full round.
+                 *
+                 * The MDS matrix M of a partial round is factored as M = M' * M'', where
+                 *      M = [[m_0_0, w], [v, M_hat]], M' = [[1, 0], [0, M_hat]], M'' = [[m_0_0, w], [v_hat, I]]
+                 * and v_hat = M_hat^-1 * v. M' does not touch the first word, so it commutes with the S-box and
+                 * is merged into the matrix of the next round, M * M', which is factored again. Every partial
+                 * round but the last one is left with the sparse M'', which takes 2 * state_words - 1
+                 * multiplications, the last one multiplies by the dense product.
+                 *
+                 * All of it is computed once from the constants of poseidon_constants, so any set of them works.
+                 */
+                template<typename PolicyType>
+                class poseidon_optimized_constants {
+                public:
+                    typedef PolicyType policy_type;
+                    typedef poseidon_constants<policy_type> poseidon_constants_type;
+
+                    typedef typename policy_type::word_type element_type;
+                    constexpr static const std::size_t state_words = policy_type::state_words;
+
+                    typedef typename poseidon_constants_type::state_vector_type state_vector_type;
+                    typedef typename poseidon_constants_type::mds_matrix_type mds_matrix_type;
+
+                    constexpr static const std::size_t full_rounds = policy_type::full_rounds;
+                    constexpr static const std::size_t half_full_rounds = policy_type::half_full_rounds;
+                    constexpr static const std::size_t part_rounds = policy_type::part_rounds;
+                    typedef algebra::matrix<element_type, full_rounds, state_words> full_round_constants_type;
+
+                    // Several states kept word by word, A[i][k] is word i of state k.
+                    template<std::size_t Lanes>
+                    using lanes_state_type = std::array<std::array<element_type, Lanes>, state_words>;
+
+                    static_assert(!policy_type::mina_version, "Mina version of Poseidon has no partial rounds.");
+                    static_assert(part_rounds > 0, "The optimized form requires partial rounds.");
+
+                    // M'' = [[m_0_0, w], [v_hat, I]].
+                    struct sparse_matrix_type {
+                        // m_0_0 followed by w.
+                        state_vector_type first_row;
+                        // v_hat, starting from index 1, first_column[0] is not used.
+                        state_vector_type first_column;
+                    };
+
+                    poseidon_optimized_constants() {
+                        // M[i][j], poseidon_constants keeps the transposed matrix.
+                        mds_matrix_type mds;
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            for (std::size_t j = 0; j < state_words; j++) {
+                                mds[i][j] = constants.mds_matrix[j][i];
+                            }
+                        }
+
+                        for (std::size_t round = 0; round < full_rounds; round++) {
+                            std::size_t round_number = round < half_full_rounds ? round : round + part_rounds;
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                full_round_constants[round][i] = constants.get_round_constant(round_number, i);
+                            }
+                        }
+
+                        state_vector_type carry;
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            carry[i] = constants.get_round_constant(half_full_rounds, i);
+                        }
+                        for (std::size_t round = 0; round < part_rounds; round++) {
+                            part_round_constants[round] = carry[0];
+                            carry[0] = element_type::zero();
+                            constants.product_with_mds_matrix(carry);
+                            if (round + 1 < part_rounds) {
+                                for (std::size_t i = 0; i < state_words; i++) {
+                                    carry[i] += constants.get_round_constant(half_full_rounds + round + 1, i);
+                                }
+                            }
+                        }
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            full_round_constants[half_full_rounds][i] += carry[i];
+                        }
+
+                        mds_matrix_type current = mds;
+                        for (std::size_t round = 0; round + 1 < part_rounds; round++) {
+                            sparse_matrix_type &sparse = sparse_matrices[round];
+                            for (std::size_t j = 0; j < state_words; j++) {
+                                sparse.first_row[j] = current[0][j];
+                            }
+                            sparse.first_column = solve_lower_right_block(current);
+
+                            // M * M', the first column of M' is (1, 0, ..., 0).
+                            mds_matrix_type next;
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                next[i][0] = mds[i][0];
+                                for (std::size_t j = 1; j < state_words; j++) {
+                                    algebra::fields::detail::element_accumulator<element_type> accum;
+                                    for (std::size_t k = 1; k < state_words; k++) {
+                                        accum.multiply_add(mds[i][k], current[k][j]);
+                                    }
+                                    next[i][j] = accum.reduce();
+                                }
+                            }
+                            current = next;
+                        }
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            for (std::size_t j = 0; j < state_words; j++) {
+                                last_part_round_matrix[i][j] = current[j][i];
+                            }
+                        }
+                    }
+
+                    /// Constant of the full round with the given number among all the rounds.
+                    inline const element_type &get_full_round_constant(std::size_t round, std::size_t i) const {
+                        return full_round_constants[round < half_full_rounds ? round : round - part_rounds][i];
+                    }
+
+                    /// Constant added to the first word in the partial round with the given number among all the rounds.
+                    inline const element_type &get_part_round_constant(std::size_t round) const {
+                        return part_round_constants[round - half_full_rounds];
+                    }
+
+                    inline void product_with_mds_matrix(state_vector_type &A_vector) const {
+                        constants.product_with_mds_matrix(A_vector);
+                    }
+
+                    /// Multiplies by the matrix of the partial round with the given number among all the rounds.
+                    inline void product_with_part_round_matrix(state_vector_type &A_vector, std::size_t round) const {
+                        std::size_t part_round = round - half_full_rounds;
+                        if (part_round + 1 == part_rounds) {
+                            poseidon_constants_type::product_with_matrix(A_vector, last_part_round_matrix);
+                            return;
+                        }
+
+                        const sparse_matrix_type &sparse = sparse_matrices[part_round];
+                        algebra::fields::detail::element_accumulator<element_type> accum;
+                        for (std::size_t j = 0; j < state_words; j++) {
+                            accum.multiply_add(A_vector[j], sparse.first_row[j]);
+                        }
+                        for (std::size_t i = 1; i < state_words; i++) {
+                            A_vector[i] += sparse.first_column[i] * A_vector[0];
+                        }
+                        A_vector[0] = accum.reduce();
+                    }
+
+                    /// Same as product_with_mds_matrix for the first 'count' states of A.
+                    template<std::size_t Lanes>
+                    inline void product_with_mds_matrix(lanes_state_type<Lanes> &A, std::size_t count) const {
+                        product_with_matrix(A, count, constants.mds_matrix);
+                    }
+
+                    /// Same as product_with_part_round_matrix for the first 'count' states of A.
+                    template<std::size_t Lanes>
+                    inline void product_with_part_round_matrix(lanes_state_type<Lanes> &A, std::size_t count,
+                                                               std::size_t round) const {
+                        std::size_t part_round = round - half_full_rounds;
+                        if (part_round + 1 == part_rounds) {
+                            product_with_matrix(A, count, last_part_round_matrix);
+                            return;
+                        }
+
+                        const sparse_matrix_type &sparse = sparse_matrices[part_round];
+                        std::array<algebra::fields::detail::element_accumulator<element_type>, Lanes> accums;
+                        for (std::size_t j = 0; j < state_words; j++) {
+                            for (std::size_t k = 0; k < count; k++) {
+                                accums[k].multiply_add(A[j][k], sparse.first_row[j]);
+                            }
+                        }
+                        for (std::size_t i = 1; i < state_words; i++) {
+                            for (std::size_t k = 0; k < count; k++) {
+                                A[i][k] += sparse.first_column[i] * A[0][k];
+                            }
+                        }
+                        for (std::size_t k = 0; k < count; k++) {
+                            A[0][k] = accums[k].reduce();
+                        }
+                    }
+
+                private:
+                    // 'matrix' is transposed, as the mds_matrix of poseidon_constants.
+                    template<std::size_t Lanes>
+                    static void product_with_matrix(lanes_state_type<Lanes> &A, std::size_t count,
+                                                    const mds_matrix_type &matrix) {
+                        lanes_state_type<Lanes> result;
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            std::array<algebra::fields::detail::element_accumulator<element_type>, Lanes> accums;
+                            for (std::size_t j = 0; j < state_words; j++) {
+                                for (std::size_t k = 0; k < count; k++) {
+                                    accums[k].multiply_add(A[j][k], matrix[j][i]);
+                                }
+                            }
+                            for (std::size_t k = 0; k < count; k++) {
+                                result[i][k] = accums[k].reduce();
+                            }
+                        }
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            for (std::size_t k = 0; k < count; k++) {
+                                A[i][k] = result[i][k];
+                            }
+                        }
+                    }
+
+                    // Returns v_hat = M_hat^-1 * v for m = [[m_0_0, w], [v, M_hat]] by Gauss-Jordan elimination.
+                    // All the square submatrices of an MDS matrix are invertible, and so are the products of the
+                    // blocks M_hat we get here.
+                    static state_vector_type solve_lower_right_block(const mds_matrix_type &m) {
+                        constexpr std::size_t n = state_words - 1;
+                        // Row i is (M_hat[i], v[i]).
+                        std::array<std::array<element_type, n + 1>, n> rows;
+                        for (std::size_t i = 0; i < n; i++) {
+                            for (std::size_t j = 0; j < n; j++) {
+                                rows[i][j] = m[i + 1][j + 1];
+                            }
+                            rows[i][n] = m[i + 1][0];
+                        }
+
+                        for (std::size_t col = 0; col < n; col++) {
+                            std::size_t pivot = col;
+                            while (pivot < n && rows[pivot][col].is_zero()) {
+                                pivot++;
+                            }
+                            BOOST_ASSERT_MSG(pivot < n, "The MDS matrix of Poseidon has a singular submatrix.");
+                            std::swap(rows[col], rows[pivot]);
+
+                            element_type inversed = rows[col][col].inversed();
+                            for (std::size_t j = col; j <= n; j++) {
+                                rows[col][j] *= inversed;
+                            }
+                            for (std::size_t i = 0; i < n; i++) {
+                                if (i == col || rows[i][col].is_zero()) {
+                                    continue;
+                                }
+                                element_type factor = rows[i][col];
+                                for (std::size_t j = col; j <= n; j++) {
+                                    rows[i][j] -= factor * rows[col][j];
+                                }
+                            }
+                        }
+
+                        state_vector_type result;
+                        result[0] = element_type::zero();
+                        for (std::size_t i = 0; i < n; i++) {
+                            result[i + 1] = rows[i][n];
+                        }
+                        return result;
+                    }
+
+                    poseidon_constants_type constants;
+                    full_round_constants_type full_round_constants;
+                    std::array<element_type, part_rounds> part_round_constants;
+                    std::array<sparse_matrix_type, part_rounds - 1> sparse_matrices;
+                    // Transposed, as the mds_matrix of poseidon_constants.
+                    mds_matrix_type last_part_round_matrix;
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_POSEIDON_OPTIMIZED_CONSTANTS_HPP
@@ -25,9 +25,11 @@ namespace nil {
                  * @tparam Rate Rate of input block for Poseidon permutation in field elements
                  * @tparam Capacity Capacity or inner part of Poseidon permutation in field elements
                  * @tparam Security mode of Poseidon permutation
+                 * @tparam Optimized Use the equivalent form of the partial rounds from Appendix B of the Poseidon paper,
+                 *      with sparse matrices and a single round constant per round. The output is the same.
                  */
                 // base_poseidon_policy<FieldType, 128, 4, 1, 5, 8, 60, false> {};
-                template<typename FieldType, std::size_t Security, std::size_t Rate, std::size_t Capacity, std::size_t SBoxPower, std::size_t FullRounds, std::size_t PartRounds, bool MinaVersion>
+                template<typename FieldType, std::size_t Security, std::size_t Rate, std::size_t Capacity, std::size_t SBoxPower, std::size_t FullRounds, std::size_t PartRounds, bool MinaVersion, bool Optimized = true>
                 struct base_poseidon_policy {
                     using field_type = FieldType;
 
@@ -52,6 +54,7 @@ namespace nil {
                     constexpr static const std::size_t sbox_power = SBoxPower;
 
                     constexpr static const bool mina_version = MinaVersion;
+                    constexpr static const bool optimized = Optimized;
 
                     struct iv_generator {
                         // TODO: maybe it would be done in constexpr way
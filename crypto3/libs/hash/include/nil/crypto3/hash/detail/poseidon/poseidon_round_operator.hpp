@@ -12,6 +12,7 @@
 
 #include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
 #include <nil/crypto3/hash/detail/poseidon/poseidon_constants.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_optimized_constants.hpp>
 
 #include <boost/assert.hpp>
 
@@ -20,15 +21,27 @@ namespace nil {
         namespace hashes {
             namespace detail {
 
-                // TODO(martun): Poseidon paper describes an optimized round, which can work faster when
-                // the Rate is high. Consider implementing it later.
+                /// S-box x^SBoxPower, with the shortest addition chains for the powers of 5 and 7.
+                template<std::size_t SBoxPower, typename ElementType>
+                inline ElementType poseidon_sbox(const ElementType &x) {
+                    if constexpr (SBoxPower == 5) {
+                        return x.squared().squared() * x;
+                    } else if constexpr (SBoxPower == 7) {
+                        ElementType x3 = x.squared() * x;
+                        return x3.squared() * x;
+                    } else {
+                        return x.pow(SBoxPower);
+                    }
+                }
+
                 template<typename poseidon_policy_type, typename Enable=void>
                 class poseidon_round_operator;
 
                 /// Round for the original version, ARC-SBOX-MDS order.
                 template<typename poseidon_policy_type>
                 class poseidon_round_operator<poseidon_policy_type,
-                                              std::enable_if_t<!poseidon_policy_type::mina_version>> {
+                                              std::enable_if_t<!poseidon_policy_type::mina_version &&
+                                                               !poseidon_policy_type::optimized>> {
                 public:
                     typedef poseidon_policy_type policy_type;
 
@@ -52,7 +65,7 @@ namespace nil {
                                          "Wrong usage of the full round function of original Poseidon.");
                         for (std::size_t i = 0; i < state_words; i++) {
                             A[i] += get_constants().get_round_constant(round_number, i);
-                            A[i] = A[i].pow(sbox_power);
+                            A[i] = poseidon_sbox<sbox_power>(A[i]);
                         }
                         get_constants().product_with_mds_matrix(A);
                     }
@@ -64,19 +77,68 @@ namespace nil {
                         for (std::size_t i = 0; i < state_words; i++) {
                             A[i] += get_constants().get_round_constant(round_number, i);
                         }
-                        A[0] = A[0].pow(sbox_power);
+                        A[0] = poseidon_sbox<sbox_power>(A[0]);
                         get_constants().product_with_mds_matrix(A);
                     }
 
                 private:
                     // Contains all the constants: mds matrix and round constants.
                     // Default constructor selects the right ones.
-                    static const poseidon_constants<poseidon_policy_type> get_constants() {
+                    static const poseidon_constants<poseidon_policy_type> &get_constants() {
                         static const poseidon_constants<poseidon_policy_type> constants;
                         return constants;
                     }
                 };
 
+                /// Round for the original version in the equivalent form with sparse matrices in the partial rounds.
+                /// Computes the same permutation, see poseidon_optimized_constants.
+                template<typename poseidon_policy_type>
+                class poseidon_round_operator<poseidon_policy_type,
+                                              std::enable_if_t<!poseidon_policy_type::mina_version &&
+                                                               poseidon_policy_type::optimized>> {
+                public:
+                    typedef poseidon_policy_type policy_type;
+
+                    typedef poseidon_optimized_constants<policy_type> poseidon_constants_type;
+
+                    typedef typename policy_type::word_type element_type;
+                    typedef typename poseidon_constants_type::state_vector_type state_vector_type;
+
+                    constexpr static const std::size_t state_words = policy_type::state_words;
+                    typedef typename policy_type::state_type state_type;
+
+                    constexpr static const std::size_t full_rounds = policy_type::full_rounds;
+                    constexpr static const std::size_t half_full_rounds = policy_type::half_full_rounds;
+                    constexpr static const std::size_t part_rounds = policy_type::part_rounds;
+                    constexpr static const std::size_t sbox_power = policy_type::sbox_power;
+
+                    static void full_round(state_vector_type &A, std::size_t round_number) {
+                        BOOST_ASSERT_MSG(round_number < half_full_rounds ||
+                                             round_number >= half_full_rounds + part_rounds,
+                                         "Wrong usage of the full round function of original Poseidon.");
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            A[i] += get_constants().get_full_round_constant(round_number, i);
+                            A[i] = poseidon_sbox<sbox_power>(A[i]);
+                        }
+                        get_constants().product_with_mds_matrix(A);
+                    }
+
+                    static void part_round(state_vector_type &A, std::size_t round_number) {
+                        BOOST_ASSERT_MSG(round_number >= half_full_rounds &&
+                                             round_number < half_full_rounds + part_rounds,
+                                         "Wrong usage of the part round function of original Poseidon.");
+                        A[0] += get_constants().get_part_round_constant(round_number);
+                        A[0] = poseidon_sbox<sbox_power>(A[0]);
+                        get_constants().product_with_part_round_matrix(A, round_number);
+                    }
+
+                    // Also used by poseidon_multi_state, which runs the same rounds on several states.
+                    static const poseidon_optimized_constants<poseidon_policy_type> &get_constants() {
+                        static const poseidon_optimized_constants<poseidon_policy_type> constants;
+                        return constants;
+                    }
+                };
+
                 /// Rounds for Mina version have SBOX-MDS-ARC order.
                 template<typename poseidon_policy_type>
                 class poseidon_round_operator<poseidon_policy_type,
@@ -104,7 +166,7 @@ namespace nil {
                                              round_number >= half_full_rounds + part_rounds,
                                          "Wrong usage of the Full round function of Mina Poseidon.");
                         for (std::size_t i = 0; i < state_words; i++) {
-                            A[i] = A[i].pow(sbox_power);
+                            A[i] = poseidon_sbox<sbox_power>(A[i]);
                         }
                         get_constants().product_with_mds_matrix(A);
                         for (std::size_t i = 0; i < state_words; i++) {
@@ -116,7 +178,7 @@ namespace nil {
                         BOOST_ASSERT_MSG(round_number >= half_full_rounds &&
                                              round_number < half_full_rounds + part_rounds,
                                          "Wrong usage of the part round function of Mina Poseidon.");
-                        A[0] = A[0].pow(sbox_power);
+                        A[0] = poseidon_sbox<sbox_power>(A[0]);
                         get_constants().product_with_mds_matrix(A);
                         for (std::size_t i = 0; i < state_words; i++) {
                             A[i] += get_constants().get_round_constant(round_number, i);
@@ -126,7 +188,7 @@ namespace nil {
                 private:
                     // Contains all the constants: mds matrix and round constants.
                     // Default constructor selects the right ones.
-                    static const poseidon_constants<poseidon_policy_type> get_constants() {
+                    static const poseidon_constants<poseidon_policy_type> &get_constants() {
                         static const poseidon_constants<poseidon_policy_type> constants;
                         return constants;
                     }
@@ -120,6 +120,9 @@ namespace nil {
             template<typename Field, typename Hash, typename Params>
             struct h2f;
 
+            template<std::size_t DigestBits>
+            class keccak_1600;
+
             template<typename Group, typename Hash, typename Params>
             struct h2c;
 
@@ -152,6 +155,12 @@ namespace nil {
             template<typename Group, typename Hash, typename Params>
             struct is_h2c<h2c<Group, Hash, Params>> : std::integral_constant<bool, true> { };
 
+            template<typename Hash>
+            struct is_keccak_1600 : std::integral_constant<bool, false> { };
+
+            template<std::size_t DigestBits>
+            struct is_keccak_1600<keccak_1600<DigestBits>> : std::integral_constant<bool, true> { };
+
             // TODO: change this to more generic type trait to check for all sponge based hashes.
             template<typename HashType, typename Enable = void>
             struct is_poseidon {
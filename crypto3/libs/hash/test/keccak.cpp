@@ -26,6 +26,7 @@
 #define BOOST_TEST_MODULE keccak_test
 
 #include <iostream>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -35,6 +36,7 @@
 #include <boost/property_tree/json_parser.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_batch.hpp>
 #include <nil/crypto3/hash/adaptor/hashed.hpp>
 
 #include <nil/crypto3/hash/keccak.hpp>
@@ -482,3 +484,36 @@ BOOST_AUTO_TEST_CASE(keccak_512_preprocessor2) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(keccak_batch_test_suite)
+
+template<typename Hash>
+void check_hash_batch(std::size_t count, std::size_t length) {
+    std::vector<std::vector<std::uint8_t>> messages(count, std::vector<std::uint8_t>(length));
+    std::vector<const std::uint8_t *> pointers;
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t j = 0; j < length; ++j) {
+            messages[i][j] = static_cast<std::uint8_t>(i * 131 + j * 7);
+        }
+        pointers.push_back(messages[i].data());
+    }
+
+    std::vector<typename Hash::digest_type> digests(count);
+    hash_batch<Hash>(pointers.data(), length, count, digests.data());
+
+    for (std::size_t i = 0; i < count; ++i) {
+        typename Hash::digest_type expected = hash<Hash>(messages[i]);
+        BOOST_CHECK_EQUAL(std::to_string(digests[i]), std::to_string(expected));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(keccak_hash_batch) {
+    // 13 messages use the 8-lane, the 4-lane and the single message paths, lengths go around the block sizes.
+    for (std::size_t length : {0, 1, 64, 71, 72, 73, 135, 136, 137, 300}) {
+        check_hash_batch<hashes::keccak_1600<224>>(13, length);
+        check_hash_batch<hashes::keccak_1600<256>>(13, length);
+        check_hash_batch<hashes::keccak_1600<512>>(13, length);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
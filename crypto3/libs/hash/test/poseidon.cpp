@@ -21,7 +21,9 @@
 #include <boost/property_tree/ptree.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_batch.hpp>
 #include <nil/crypto3/hash/block_to_field_elements_wrapper.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_multi_state.hpp>
 #include <nil/crypto3/hash/detail/poseidon/poseidon_permutation.hpp>
 #include <nil/crypto3/hash/hash_state.hpp>
 #include <nil/crypto3/hash/poseidon.hpp>
@@ -29,6 +31,7 @@
 #include <nil/crypto3/algebra/fields/alt_bn128/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/pallas/base_field.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 using namespace nil::crypto3;
 using namespace nil::crypto3::accumulators;
@@ -98,6 +101,59 @@ void test_poseidon_permutation(
     BOOST_CHECK_EQUAL(input, expected_result);
 }
 
+// Compares the optimized partial rounds with the straightforward ones on random states.
+template<typename FieldType, std::size_t Rate, std::size_t PartRounds>
+void test_poseidon_optimized_permutation() {
+    using optimized_policy = poseidon_policy<FieldType, 128, Rate>;
+    using reference_policy = base_poseidon_policy<FieldType, 128, Rate, 1, 5, 8, PartRounds, false, false>;
+    static_assert(optimized_policy::optimized && optimized_policy::part_rounds == PartRounds);
+
+    for (std::size_t i = 0; i < 10; i++) {
+        typename optimized_policy::state_type state;
+        for (auto &word: state) {
+            word = random_element<FieldType>();
+        }
+        typename optimized_policy::state_type expected_result = state;
+        poseidon_permutation<reference_policy>::permute(expected_result);
+        poseidon_permutation<optimized_policy>::permute(state);
+        BOOST_CHECK_EQUAL(state, expected_result);
+    }
+}
+
+template<typename FieldType, std::size_t Rate>
+void test_poseidon_hash_batch(std::size_t count, std::size_t length) {
+    using policy = poseidon_policy<FieldType, 128, Rate>;
+    using hash_t = hashes::poseidon<policy>;
+
+    std::vector<std::vector<typename FieldType::value_type>> messages(count);
+    std::vector<const typename FieldType::value_type *> pointers;
+    for (auto &message: messages) {
+        for (std::size_t j = 0; j < length; j++) {
+            message.push_back(random_element<FieldType>());
+        }
+        pointers.push_back(message.data());
+    }
+
+    std::vector<typename hash_t::digest_type> digests(count);
+    hash_batch<hash_t>(pointers.data(), length, count, digests.data());
+    for (std::size_t i = 0; i < count; i++) {
+        BOOST_CHECK_EQUAL(digests[i], hash<hash_t>(messages[i]));
+    }
+
+    std::vector<typename policy::state_type> states(count), expected_states(count);
+    for (std::size_t i = 0; i < count; i++) {
+        for (auto &word: states[i]) {
+            word = random_element<FieldType>();
+        }
+        expected_states[i] = states[i];
+        poseidon_permutation<policy>::permute(expected_states[i]);
+    }
+    poseidon_multi_state<policy>::permute(states.data(), count);
+    for (std::size_t i = 0; i < count; i++) {
+        BOOST_CHECK_EQUAL(states[i], expected_states[i]);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(poseidon_tests)
 
 // Test data for Mina version was taken from https://github.com/o1-labs/proof-systems/blob/a36c088b3e81d17f5720abfff82a49cf9cb1ad5b/poseidon/src/tests/test_vectors/kimchi.json.
@@ -213,6 +269,16 @@ BOOST_AUTO_TEST_SUITE(poseidon_tests)
         );
     }
 
+    BOOST_AUTO_TEST_CASE(poseidon_optimized_permutation_254) {
+        test_poseidon_optimized_permutation<fields::alt_bn128_scalar_field<254>, 2, 57>();
+        test_poseidon_optimized_permutation<fields::alt_bn128_scalar_field<254>, 4, 60>();
+    }
+
+    BOOST_AUTO_TEST_CASE(poseidon_optimized_permutation_255) {
+        test_poseidon_optimized_permutation<fields::bls12_scalar_field<381>, 2, 57>();
+        test_poseidon_optimized_permutation<fields::bls12_scalar_field<381>, 4, 60>();
+    }
+
     BOOST_AUTO_TEST_CASE(nil_poseidon_accumulator_255_4) {
         using policy = poseidon_policy<fields::bls12_scalar_field<381>, 128, /*Rate=*/ 4>;
         using hash_t = hashes::poseidon<policy>;
@@ -286,6 +352,14 @@ BOOST_AUTO_TEST_SUITE(poseidon_tests)
         BOOST_CHECK_EQUAL(d_uint8, d_field);
     }
 
+    BOOST_AUTO_TEST_CASE(poseidon_hash_batch) {
+        // 13 messages fill one batch of lanes and a part of the next one, lengths go around the rate.
+        for (std::size_t length : {0, 1, 2, 3, 4, 5, 9}) {
+            test_poseidon_hash_batch<fields::alt_bn128_scalar_field<254>, 2>(13, length);
+            test_poseidon_hash_batch<fields::bls12_scalar_field<381>, 4>(13, length);
+        }
+    }
+
 // This test can be useful for constants generation in the future.
 //BOOST_AUTO_TEST_CASE(poseidon_generate_pallas_constants) {
 //
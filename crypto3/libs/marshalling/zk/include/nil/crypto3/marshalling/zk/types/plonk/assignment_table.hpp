@@ -25,6 +25,8 @@
 #ifndef CRYPTO3_MARSHALLING_ZK_PLONK_ASSIGNMENT_TABLE_HPP
 #define CRYPTO3_MARSHALLING_ZK_PLONK_ASSIGNMENT_TABLE_HPP
 
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <type_traits>
 
@@ -172,6 +174,32 @@ namespace nil {
                     return result;
                 }
 
+                /**
+                 * Encodes rows [begin, end) of the column into 'out' the same way plonk_assignment_table stores
+                 * them, rows past the end of the column are encoded as zeroes. Writers use it to serialize the
+                 * columns in bulk, without building the marshalling containers for the whole table.
+                 */
+                template<typename Endianness, typename FieldValueType, typename ColumnType>
+                void write_field_element_column_rows(
+                    const ColumnType &column,
+                    std::size_t begin,
+                    std::size_t end,
+                    std::uint8_t *out) {
+
+                    using field_element_type = field_element<nil::marshalling::field_type<Endianness>, FieldValueType>;
+                    constexpr std::size_t element_size = field_element_type::length();
+
+                    for (std::size_t row = begin; row < end; ++row, out += element_size) {
+                        if (row >= column.size() || column[row].is_zero()) {
+                            std::memset(out, 0, element_size);
+                            continue;
+                        }
+                        field_element_type element(column[row]);
+                        auto write_iter = out;
+                        element.write(write_iter, element_size);
+                    }
+                }
+
                 template<typename FieldValueType, typename Endianness>
                 std::vector<std::vector<FieldValueType>> make_field_element_columns_vector(
                     const nil::marshalling::types::array_list<
@@ -0,0 +1,446 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MARSHALLING_ZK_PLONK_COLUMNAR_ASSIGNMENT_TABLE_HPP
+#define CRYPTO3_MARSHALLING_ZK_PLONK_COLUMNAR_ASSIGNMENT_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /////////////////////////////////////////////////////////////////////////////////////////////////////////////
+                /////////   Columnar binary format of the assignment table.
+                /////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                // Binary formats of the assignment table: 'marshalled' is plonk_assignment_table from
+                // assignment_table.hpp, 'columnar' is the format defined below.
+                enum class assignment_table_format { marshalled, columnar };
+
+                /**
+                 * Columnar format is meant to be memory-mapped and decoded one column per thread. All the
+                 * elements have the same width and the header holds the offset of every column, so no column
+                 * depends on the others.
+                 *
+                 * All the numbers are little-endian uint64:
+                 *     magic "NILCOLTB", version, element_bytes,
+                 *     witness_columns, public_input_columns, constant_columns, selector_columns,
+                 *     usable_rows_amount, rows_amount,
+                 *     column_offsets[columns_amount]
+                 * followed by witness, public input, constant and selector columns, in this order. Each column
+                 * holds rows_amount elements, an element is its integral value split into element_bytes / 8
+                 * limbs, least significant limb first. Offsets are counted from the beginning of the data and
+                 * are multiples of 8.
+                 *
+                 * The magic can't be confused with the marshalled format, which starts with the witness amount.
+                 */
+                struct columnar_assignment_table_header {
+                    static constexpr std::array<char, 8> magic = {'N', 'I', 'L', 'C', 'O', 'L', 'T', 'B'};
+                    static constexpr std::uint64_t current_version = 1;
+                    // Magic, version, element size and the table description.
+                    static constexpr std::size_t fixed_size = 9 * sizeof(std::uint64_t);
+
+                    std::uint64_t version = current_version;
+                    std::uint64_t element_bytes = 0;
+                    std::uint64_t witness_columns = 0;
+                    std::uint64_t public_input_columns = 0;
+                    std::uint64_t constant_columns = 0;
+                    std::uint64_t selector_columns = 0;
+                    std::uint64_t usable_rows_amount = 0;
+                    std::uint64_t rows_amount = 0;
+                    std::vector<std::uint64_t> column_offsets;
+
+                    std::size_t columns_amount() const {
+                        return witness_columns + public_input_columns + constant_columns + selector_columns;
+                    }
+
+                    // Size of the header in bytes.
+                    std::size_t size() const {
+                        return fixed_size + column_offsets.size() * sizeof(std::uint64_t);
+                    }
+
+                    // Size of one column in bytes.
+                    std::size_t column_size() const {
+                        return rows_amount * element_bytes;
+                    }
+                };
+
+                namespace detail {
+                    inline void write_columnar_uint64(std::uint8_t *out, std::uint64_t value) {
+                        for (std::size_t i = 0; i < sizeof(value); ++i) {
+                            out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+                        }
+                    }
+
+                    inline std::uint64_t read_columnar_uint64(const std::uint8_t *in) {
+                        std::uint64_t value = 0;
+                        for (std::size_t i = 0; i < sizeof(value); ++i) {
+                            value |= static_cast<std::uint64_t>(in[i]) << (8 * i);
+                        }
+                        return value;
+                    }
+
+                    template<typename FieldType>
+                    constexpr std::size_t columnar_limbs_amount() {
+                        static_assert(FieldType::arity == 1, "Columnar format supports prime fields only");
+                        return (FieldType::modulus_bits + 63) / 64;
+                    }
+                }    // namespace detail
+
+                template<typename FieldType>
+                constexpr std::size_t columnar_element_bytes() {
+                    return detail::columnar_limbs_amount<FieldType>() * sizeof(std::uint64_t);
+                }
+
+                template<typename FieldType>
+                columnar_assignment_table_header make_columnar_assignment_table_header(
+                    const zk::snark::plonk_table_description<FieldType> &desc
+                ) {
+                    columnar_assignment_table_header header;
+                    header.element_bytes = columnar_element_bytes<FieldType>();
+                    header.witness_columns = desc.witness_columns;
+                    header.public_input_columns = desc.public_input_columns;
+                    header.constant_columns = desc.constant_columns;
+                    header.selector_columns = desc.selector_columns;
+                    header.usable_rows_amount = desc.usable_rows_amount;
+                    header.rows_amount = desc.rows_amount;
+
+                    header.column_offsets.resize(header.columns_amount());
+                    std::uint64_t offset = header.size();
+                    for (auto &column_offset : header.column_offsets) {
+                        column_offset = offset;
+                        offset += header.column_size();
+                    }
+                    return header;
+                }
+
+                inline void write_columnar_assignment_table_header(
+                    std::ostream &out,
+                    const columnar_assignment_table_header &header
+                ) {
+                    std::vector<std::uint8_t> bytes(header.size());
+                    std::memcpy(bytes.data(), header.magic.data(), header.magic.size());
+
+                    std::uint8_t *it = bytes.data() + header.magic.size();
+                    for (std::uint64_t value : {header.version, header.element_bytes,
+                                                header.witness_columns, header.public_input_columns,
+                                                header.constant_columns, header.selector_columns,
+                                                header.usable_rows_amount, header.rows_amount}) {
+                        detail::write_columnar_uint64(it, value);
+                        it += sizeof(std::uint64_t);
+                    }
+                    for (std::uint64_t column_offset : header.column_offsets) {
+                        detail::write_columnar_uint64(it, column_offset);
+                        it += sizeof(std::uint64_t);
+                    }
+                    out.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+                }
+
+                /**
+                 * Encodes rows [begin, end) of the column into 'out', rows past the end of the column are
+                 * encoded as zeroes. 'out' must have room for (end - begin) * header.element_bytes bytes.
+                 */
+                template<typename FieldType, typename ColumnType>
+                void write_columnar_assignment_table_column_rows(
+                    const columnar_assignment_table_header &header,
+                    const ColumnType &column,
+                    std::size_t begin,
+                    std::size_t end,
+                    std::uint8_t *out
+                ) {
+                    using integral_type = typename FieldType::integral_type;
+                    constexpr std::size_t limbs_amount = detail::columnar_limbs_amount<FieldType>();
+
+                    std::array<std::uint64_t, limbs_amount> limbs;
+                    for (std::size_t row = begin; row < end; ++row, out += header.element_bytes) {
+                        limbs.fill(0);
+                        if (row < column.size() && !column[row].is_zero()) {
+                            boost::multiprecision::export_bits(
+                                integral_type(column[row].data), limbs.begin(), 64, false);
+                        }
+                        for (std::size_t j = 0; j < limbs_amount; ++j) {
+                            detail::write_columnar_uint64(out + j * sizeof(std::uint64_t), limbs[j]);
+                        }
+                    }
+                }
+
+                /**
+                 * Writes rows_amount elements of the column, padding it with zeroes. Must be called for the
+                 * columns in the order of the header right after it is written.
+                 */
+                template<typename FieldType, typename ColumnType>
+                void write_columnar_assignment_table_column(
+                    std::ostream &out,
+                    const columnar_assignment_table_header &header,
+                    const ColumnType &column
+                ) {
+                    // Elements are encoded in blocks to keep the number of stream calls low.
+                    constexpr std::size_t block_elements = 4096;
+
+                    std::vector<std::uint8_t> block;
+                    for (std::size_t row = 0; row < header.rows_amount; row += block_elements) {
+                        const std::size_t end = std::min<std::size_t>(row + block_elements, header.rows_amount);
+                        block.resize((end - row) * header.element_bytes);
+                        write_columnar_assignment_table_column_rows<FieldType>(header, column, row, end, block.data());
+                        out.write(reinterpret_cast<const char *>(block.data()), block.size());
+                    }
+                }
+
+                template<typename PlonkTable>
+                void write_columnar_assignment_table(
+                    std::ostream &out,
+                    const PlonkTable &table,
+                    const zk::snark::plonk_table_description<typename PlonkTable::field_type> &desc
+                ) {
+                    using field_type = typename PlonkTable::field_type;
+
+                    const auto header = make_columnar_assignment_table_header(desc);
+                    write_columnar_assignment_table_header(out, header);
+                    for (std::size_t i = 0; i < header.witness_columns; ++i) {
+                        write_columnar_assignment_table_column<field_type>(out, header, table.witness(i));
+                    }
+                    for (std::size_t i = 0; i < header.public_input_columns; ++i) {
+                        write_columnar_assignment_table_column<field_type>(out, header, table.public_input(i));
+                    }
+                    for (std::size_t i = 0; i < header.constant_columns; ++i) {
+                        write_columnar_assignment_table_column<field_type>(out, header, table.constant(i));
+                    }
+                    for (std::size_t i = 0; i < header.selector_columns; ++i) {
+                        write_columnar_assignment_table_column<field_type>(out, header, table.selector(i));
+                    }
+                }
+
+                inline bool is_columnar_assignment_table(const std::uint8_t *data, std::size_t size) {
+                    const auto &magic = columnar_assignment_table_header::magic;
+                    return size >= magic.size() && std::memcmp(data, magic.data(), magic.size()) == 0;
+                }
+
+                /**
+                 * Reads and validates the header, so that the columns may be decoded without bounds checks.
+                 */
+                template<typename FieldType>
+                columnar_assignment_table_header read_columnar_assignment_table_header(
+                    const std::uint8_t *data,
+                    std::size_t size
+                ) {
+                    using header_type = columnar_assignment_table_header;
+
+                    if (!is_columnar_assignment_table(data, size)) {
+                        throw std::invalid_argument("Data is not a columnar assignment table");
+                    }
+                    if (size < header_type::fixed_size) {
+                        throw std::invalid_argument("Columnar assignment table header is truncated");
+                    }
+
+                    header_type header;
+                    const std::uint8_t *it = data + header_type::magic.size();
+                    for (std::uint64_t *value : {&header.version, &header.element_bytes,
+                                                 &header.witness_columns, &header.public_input_columns,
+                                                 &header.constant_columns, &header.selector_columns,
+                                                 &header.usable_rows_amount, &header.rows_amount}) {
+                        *value = detail::read_columnar_uint64(it);
+                        it += sizeof(std::uint64_t);
+                    }
+
+                    if (header.version != header_type::current_version) {
+                        throw std::invalid_argument(
+                            "Unsupported columnar assignment table version " + std::to_string(header.version));
+                    }
+                    if (header.element_bytes != columnar_element_bytes<FieldType>()) {
+                        throw std::invalid_argument(
+                            "Columnar assignment table element size " + std::to_string(header.element_bytes) +
+                            " does not match the field, expected " +
+                            std::to_string(columnar_element_bytes<FieldType>()));
+                    }
+                    if (header.usable_rows_amount >= header.rows_amount) {
+                        throw std::invalid_argument(
+                            "Rows amount should be greater than usable rows amount. Rows amount = " +
+                            std::to_string(header.rows_amount) +
+                            ", usable rows amount = " + std::to_string(header.usable_rows_amount));
+                    }
+
+                    // Each amount is checked separately first, so that the sum does not overflow.
+                    const std::size_t max_columns = (size - header_type::fixed_size) / sizeof(std::uint64_t);
+                    if (header.witness_columns > max_columns || header.public_input_columns > max_columns ||
+                        header.constant_columns > max_columns || header.selector_columns > max_columns ||
+                        header.columns_amount() > max_columns) {
+                        throw std::invalid_argument("Columnar assignment table header is truncated");
+                    }
+                    header.column_offsets.resize(header.columns_amount());
+                    for (auto &column_offset : header.column_offsets) {
+                        column_offset = detail::read_columnar_uint64(it);
+                        it += sizeof(std::uint64_t);
+                    }
+
+                    if (header.columns_amount() != 0 && header.rows_amount > size / header.element_bytes) {
+                        throw std::invalid_argument("Columnar assignment table is truncated");
+                    }
+                    for (std::uint64_t column_offset : header.column_offsets) {
+                        if (column_offset % sizeof(std::uint64_t) != 0 || column_offset < header.size() ||
+                            column_offset > size || size - column_offset < header.column_size()) {
+                            throw std::invalid_argument("Columnar assignment table is truncated");
+                        }
+                    }
+                    return header;
+                }
+
+                /**
+                 * Decodes one column of the table. Columns are independent, so this may be called concurrently
+                 * for different columns. Throws std::invalid_argument on an element that is not less than the
+                 * modulus.
+                 */
+                template<typename FieldType, typename ColumnType>
+                void read_columnar_assignment_table_column(
+                    const std::uint8_t *data,
+                    const columnar_assignment_table_header &header,
+                    std::size_t column_index,
+                    ColumnType &column
+                ) {
+                    using integral_type = typename FieldType::integral_type;
+                    using value_type = typename FieldType::value_type;
+                    constexpr std::size_t limbs_amount = detail::columnar_limbs_amount<FieldType>();
+
+                    column.resize(header.rows_amount);
+
+                    // Vector iterators select the generic import_bits, the overload for pointers expects
+                    // the number to have a spare limb.
+                    std::vector<std::uint64_t> limbs(limbs_amount);
+                    integral_type integral;
+                    const std::uint8_t *element = data + header.column_offsets[column_index];
+                    for (std::size_t row = 0; row < header.rows_amount; ++row, element += header.element_bytes) {
+                        bool is_zero = true;
+                        for (std::size_t j = 0; j < limbs_amount; ++j) {
+                            limbs[j] = detail::read_columnar_uint64(element + j * sizeof(std::uint64_t));
+                            is_zero = is_zero && limbs[j] == 0;
+                        }
+                        if (is_zero) {
+                            column[row] = value_type::zero();
+                            continue;
+                        }
+                        boost::multiprecision::import_bits(integral, limbs.cbegin(), limbs.cend(), 64, false);
+                        if (integral >= FieldType::modulus) {
+                            throw std::invalid_argument("Columnar assignment table element is out of the field");
+                        }
+                        column[row] = value_type(integral);
+                    }
+                }
+
+                /**
+                 * Decodes the table. 'for_each_column(columns_amount, decode)' must call decode(i) once for
+                 * every column index i, possibly in parallel, and rethrow the exceptions thrown by decode.
+                 */
+                template<typename PlonkTable, typename ForEachColumn>
+                std::pair<zk::snark::plonk_table_description<typename PlonkTable::field_type>, PlonkTable>
+                make_columnar_assignment_table(
+                    const std::uint8_t *data,
+                    std::size_t size,
+                    ForEachColumn &&for_each_column
+                ) {
+                    using field_type = typename PlonkTable::field_type;
+                    using private_table = typename PlonkTable::private_table_type;
+                    using public_table = typename PlonkTable::public_table_type;
+
+                    const auto header = read_columnar_assignment_table_header<field_type>(data, size);
+
+                    zk::snark::plonk_table_description<field_type> desc(
+                        header.witness_columns,
+                        header.public_input_columns,
+                        header.constant_columns,
+                        header.selector_columns,
+                        header.usable_rows_amount,
+                        header.rows_amount
+                    );
+
+                    typename PlonkTable::witnesses_container_type witnesses(header.witness_columns);
+                    typename PlonkTable::public_input_container_type public_inputs(header.public_input_columns);
+                    typename PlonkTable::constant_container_type constants(header.constant_columns);
+                    typename PlonkTable::selector_container_type selectors(header.selector_columns);
+
+                    auto decode = [&](std::size_t column_index) {
+                        std::size_t index = column_index;
+                        if (index < witnesses.size()) {
+                            read_columnar_assignment_table_column<field_type>(data, header, column_index, witnesses[index]);
+                            return;
+                        }
+                        index -= witnesses.size();
+                        if (index < public_inputs.size()) {
+                            read_columnar_assignment_table_column<field_type>(data, header, column_index, public_inputs[index]);
+                            return;
+                        }
+                        index -= public_inputs.size();
+                        if (index < constants.size()) {
+                            read_columnar_assignment_table_column<field_type>(data, header, column_index, constants[index]);
+                            return;
+                        }
+                        index -= constants.size();
+                        read_columnar_assignment_table_column<field_type>(data, header, column_index, selectors[index]);
+                    };
+                    for_each_column(header.columns_amount(), decode);
+
+                    return std::make_pair(desc, PlonkTable(
+                        std::make_shared<private_table>(std::move(witnesses)),
+                        std::make_shared<public_table>(
+                            std::move(public_inputs),
+                            std::move(constants),
+                            std::move(selectors)
+                        )
+                    ));
+                }
+
+                template<typename PlonkTable>
+                std::pair<zk::snark::plonk_table_description<typename PlonkTable::field_type>, PlonkTable>
+                make_columnar_assignment_table(const std::uint8_t *data, std::size_t size) {
+                    return make_columnar_assignment_table<PlonkTable>(
+                        data, size,
+                        [](std::size_t columns_amount, const auto &decode) {
+                            for (std::size_t i = 0; i < columns_amount; ++i) {
+                                decode(i);
+                            }
+                        });
+                }
+
+            } //namespace types
+        } // namespace marshalling
+    } // namespace crypto3
+} // namespace nil
+
+#endif    // CRYPTO3_MARSHALLING_ZK_PLONK_COLUMNAR_ASSIGNMENT_TABLE_HPP
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include <sstream>
 #include <filesystem>
 
 #include <nil/marshalling/status_type.hpp>
@@ -24,6 +25,7 @@
 #include <nil/crypto3/random/algebraic_random_device.hpp>
 #include <nil/crypto3/marshalling/zk/types/plonk/variable.hpp>
 #include <nil/crypto3/marshalling/zk/types/plonk/assignment_table.hpp>
+#include <nil/crypto3/marshalling/zk/types/plonk/columnar_assignment_table.hpp>
 
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
@@ -138,11 +140,42 @@ struct plonk_assignment_table_test_runner {
         return true;
     }
 
+    bool test_columnar_assignment_table()
+    {
+        using plonk_table = plonk_assignment_table<field_type>;
+
+        plonk_table const& val = assignments;
+
+        std::stringstream out;
+        types::write_columnar_assignment_table(out, val, desc);
+        const std::string bytes = out.str();
+        const auto *data = reinterpret_cast<const std::uint8_t *>(bytes.data());
+        BOOST_CHECK(types::is_columnar_assignment_table(data, bytes.size()));
+
+        auto table_desc_pair = types::make_columnar_assignment_table<plonk_table>(data, bytes.size());
+        BOOST_CHECK(val == table_desc_pair.second);
+        BOOST_CHECK(desc == table_desc_pair.first);
+
+        BOOST_CHECK_THROW(types::make_columnar_assignment_table<plonk_table>(data, bytes.size() - 1),
+                          std::invalid_argument);
+
+        // The last element of the last column with all the bits set is not a field element.
+        const auto header = types::make_columnar_assignment_table_header(desc);
+        std::string corrupted = bytes;
+        std::fill(corrupted.end() - header.element_bytes, corrupted.end(), char(0xFF));
+        BOOST_CHECK_THROW(types::make_columnar_assignment_table<plonk_table>(
+                              reinterpret_cast<const std::uint8_t *>(corrupted.data()), corrupted.size()),
+                          std::invalid_argument);
+
+        return true;
+    }
+
     bool run_test()
     {
         using Endianness = nil::marshalling::option::big_endian;
         BOOST_CHECK(test_assignment_table_description<Endianness>());
         BOOST_CHECK(test_assignment_table<Endianness>());
+        BOOST_CHECK(test_columnar_assignment_table());
         return true;
     }
 
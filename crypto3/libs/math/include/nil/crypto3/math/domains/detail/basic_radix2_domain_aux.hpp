@@ -33,6 +33,7 @@
 
 #include <nil/crypto3/algebra/type_traits.hpp>
 
+#include <nil/crypto3/math/algorithms/batch_inversion.hpp>
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
 
@@ -163,13 +164,18 @@ namespace nil {
                      */
 
                     const value_type Z = (t.pow(m)) - value_type::one();
-                    value_type l = Z * value_type(m).inversed();
                     value_type r = value_type::one();
                     for (std::size_t i = 0; i < m; ++i) {
-                        u[i] = l * (t - r).inversed();
-                        l *= omega;
+                        u[i] = t - r;
                         r *= omega;
                     }
+                    math::batch_inversion(u);
+
+                    value_type l = Z * value_type(m).inversed();
+                    for (std::size_t i = 0; i < m; ++i) {
+                        u[i] *= l;
+                        l *= omega;
+                    }
 
                     return u;
                 }
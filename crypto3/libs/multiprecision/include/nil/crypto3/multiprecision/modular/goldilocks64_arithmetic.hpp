@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MULTIPRECISION_MODULAR_GOLDILOCKS64_ARITHMETIC_HPP
+#define CRYPTO3_MULTIPRECISION_MODULAR_GOLDILOCKS64_ARITHMETIC_HPP
+
+#include <boost/config.hpp>
+
+#include <cstdint>
+
+namespace boost {
+    namespace multiprecision {
+        namespace backends {
+            // Arithmetic modulo the Goldilocks prime p = 2^64 - 2^32 + 1 on plain 64-bit words.
+            // All the values are expected to be canonical, i.e. lesser than p, and so are the results.
+            // Multiplication works in Montgomery form with R = 2^64, the same form modular_adaptor keeps
+            // its values in, so these functions may be applied to the limb of a cpp_int_modular_backend<64> directly.
+            namespace goldilocks64 {
+                constexpr std::uint64_t modulus = 0xFFFFFFFF00000001ULL;
+
+                // 2^64 mod p, what we need to add after the 64-bit addition overflows.
+                constexpr std::uint64_t epsilon = 0xFFFFFFFFULL;
+
+                constexpr std::uint64_t add(std::uint64_t a, std::uint64_t b) {
+                    std::uint64_t s = a + b;
+                    // The sum is at most 2p - 2 < 2^64 + p, so one correction is always enough.
+                    s += (s < a) ? epsilon : 0u;
+                    return s >= modulus ? s - modulus : s;
+                }
+
+                constexpr std::uint64_t sub(std::uint64_t a, std::uint64_t b) {
+                    std::uint64_t d = a - b;
+                    // On borrow d = a - b + 2^64, and a - b + p = d - (2^64 - p).
+                    return (a < b) ? d - epsilon : d;
+                }
+
+                constexpr std::uint64_t negate(std::uint64_t a) {
+                    return a == 0u ? 0u : modulus - a;
+                }
+
+                // Computes x * 2^-64 mod p for x = hi * 2^64 + lo < p * 2^64. Uses the special form of p:
+                // -p^-1 mod 2^64 = 2^32 + 1, so the Montgomery quotient and m * p are shifts and subtractions.
+                constexpr std::uint64_t montgomery_reduce(std::uint64_t lo, std::uint64_t hi) {
+                    std::uint64_t a = lo + (lo << 32);
+                    std::uint64_t e = (a < lo) ? 1u : 0u;
+                    std::uint64_t b = a - (a >> 32) - e;
+                    std::uint64_t r = hi - b;
+                    r -= (hi < b) ? epsilon : 0u;
+                    return r >= modulus ? r - modulus : r;
+                }
+
+                // Full 128-bit product of two words, returns the low word and stores the high one.
+                constexpr std::uint64_t mul_wide(std::uint64_t a, std::uint64_t b, std::uint64_t &hi) {
+#ifdef BOOST_HAS_INT128
+                    unsigned __int128 p = static_cast<unsigned __int128>(a) * b;
+                    hi = static_cast<std::uint64_t>(p >> 64);
+                    return static_cast<std::uint64_t>(p);
+#else
+                    std::uint64_t a_lo = a & 0xFFFFFFFFULL, a_hi = a >> 32;
+                    std::uint64_t b_lo = b & 0xFFFFFFFFULL, b_hi = b >> 32;
+                    std::uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+                    std::uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFULL) + (hl & 0xFFFFFFFFULL);
+                    hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+                    return (mid << 32) | (ll & 0xFFFFFFFFULL);
+#endif
+                }
+
+                // Montgomery product a * b * 2^-64 mod p.
+                constexpr std::uint64_t montgomery_mul(std::uint64_t a, std::uint64_t b) {
+                    std::uint64_t hi = 0;
+                    std::uint64_t lo = mul_wide(a, b, hi);
+                    return montgomery_reduce(lo, hi);
+                }
+            }    // namespace goldilocks64
+        }    // namespace backends
+    }   // namespace multiprecision
+}   // namespace boost
+
+#endif    // CRYPTO3_MULTIPRECISION_MODULAR_GOLDILOCKS64_ARITHMETIC_HPP
@@ -47,9 +47,26 @@ namespace boost {
                 BOOST_MP_CXX14_CONSTEXPR const modular_type &mod_data() const {
                     return m_mod;
                 }
+
+                // The modulus is known at compile time, so is the multiplication algorithm to use for it.
+                template<typename Backend1>
+                BOOST_MP_CXX14_CONSTEXPR void mod_mul(Backend1 &result, const Backend1 &y) const {
+                    m_mod.template mod_mul_ct<is_odd_mod, no_carry_montgomery_mul_allowed, is_goldilocks64_mod>(
+                        result, y);
+                }
+
+                template<typename Backend1>
+                BOOST_MP_CXX14_CONSTEXPR void mod_add(Backend1 &result, const Backend1 &y) const {
+                    m_mod.template mod_add_ct<is_goldilocks64_mod>(result, y);
+                }
  
             protected:
                 BOOST_MP_CXX14_CONSTEXPR static const modular_type m_mod = Modulus;
+
+                static constexpr bool is_odd_mod = Modulus.get_is_odd_mod();
+                static constexpr bool no_carry_montgomery_mul_allowed =
+                    Modulus.get_mod_obj().is_applicable_for_no_carry_montgomery_mul();
+                static constexpr bool is_goldilocks64_mod = Modulus.get_mod_obj().is_goldilocks64_modulus();
             };
  
             // Must be used only in the tests, we must normally use only modular_params_ct.
@@ -79,6 +96,16 @@ namespace boost {
                 BOOST_MP_CXX14_CONSTEXPR const modular_type &mod_data() const {
                     return m_mod;
                 }
+
+                template<typename Backend1>
+                BOOST_MP_CXX14_CONSTEXPR void mod_mul(Backend1 &result, const Backend1 &y) const {
+                    m_mod.mod_mul(result, y);
+                }
+
+                template<typename Backend1>
+                BOOST_MP_CXX14_CONSTEXPR void mod_add(Backend1 &result, const Backend1 &y) const {
+                    m_mod.mod_add(result, y);
+                }
  
             public:
                 modular_type m_mod;
@@ -29,6 +29,7 @@ namespace boost {
             public:
                 typedef modular_params<Backend> modular_type;
                 typedef Backend backend_type;
+                typedef typename modular_type::accumulator_type accumulator_type;
 
             protected:
                 typedef typename modular_type::policy_type policy_type;
@@ -282,7 +283,7 @@ namespace boost {
                 modular_adaptor<cpp_int_modular_backend<Bits>, StorageType> &result,
                 const modular_adaptor<cpp_int_modular_backend<Bits>, StorageType> &o) {
                 BOOST_ASSERT(eval_eq(result.mod_data().get_mod(), o.mod_data().get_mod()));
-                result.mod_data().mod_add(result.base_data(), o.base_data());
+                result.mod_add(result.base_data(), o.base_data());
             }
 
             template<unsigned Bits, typename Backend,
@@ -304,7 +305,7 @@ namespace boost {
             BOOST_MP_CXX14_CONSTEXPR void eval_multiply(
                     modular_adaptor<cpp_int_modular_backend<Bits>, StorageType> &result,
                     const modular_adaptor<cpp_int_modular_backend<Bits>, StorageType> &o) {
-                result.mod_data().mod_mul(result.base_data(), o.base_data());
+                result.mod_mul(result.base_data(), o.base_data());
             }
 
             template<unsigned Bits, typename Backend, typename StorageType>
@@ -321,6 +322,32 @@ namespace boost {
                 o.mod_data().mod_mul(result.base_data(), o.base_data());
             }
 
+            // accum += a * b without the modular reduction, see modular_params::mod_multiply_accumulate.
+            template<unsigned Bits, typename StorageType>
+            BOOST_MP_CXX14_CONSTEXPR void eval_multiply_accumulate(
+                    typename modular_adaptor<cpp_int_modular_backend<Bits>, StorageType>::accumulator_type &accum,
+                    const modular_adaptor<cpp_int_modular_backend<Bits>, StorageType> &a,
+                    const modular_adaptor<cpp_int_modular_backend<Bits>, StorageType> &b) {
+                a.mod_data().mod_multiply_accumulate(accum, a.base_data(), b.base_data());
+            }
+
+            // accum += a without the modular reduction, see modular_params::mod_add_accumulate.
+            template<unsigned Bits, typename StorageType>
+            BOOST_MP_CXX14_CONSTEXPR void eval_add_accumulate(
+                    typename modular_adaptor<cpp_int_modular_backend<Bits>, StorageType>::accumulator_type &accum,
+                    const modular_adaptor<cpp_int_modular_backend<Bits>, StorageType> &a) {
+                a.mod_data().mod_add_accumulate(accum, a.base_data());
+            }
+
+            // Sets result to the sum of products collected in 'accum' by eval_multiply_accumulate.
+            // 'accum' is destroyed, and 'result' must already have the same modular params as the products.
+            template<unsigned Bits, typename StorageType>
+            BOOST_MP_CXX14_CONSTEXPR void eval_reduce_accumulator(
+                    modular_adaptor<cpp_int_modular_backend<Bits>, StorageType> &result,
+                    typename modular_adaptor<cpp_int_modular_backend<Bits>, StorageType>::accumulator_type &accum) {
+                result.mod_data().mod_reduce_accumulator(result.base_data(), accum);
+            }
+
             template<unsigned Bits, typename Backend, typename T, typename StorageType>
             BOOST_MP_CXX14_CONSTEXPR void eval_powm(
                     modular_adaptor<cpp_int_modular_backend<Bits>, StorageType> &result,
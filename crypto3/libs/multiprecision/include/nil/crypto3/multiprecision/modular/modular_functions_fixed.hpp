@@ -13,6 +13,8 @@
 
 #include <boost/multiprecision/detail/number_base.hpp>
 #include <nil/crypto3/multiprecision/modular/modular_policy_fixed.hpp>
+#include <nil/crypto3/multiprecision/modular/goldilocks64_arithmetic.hpp>
+#include <nil/crypto3/multiprecision/modular/montgomery_mul_adx.hpp>
 
 #include <boost/mpl/if.hpp>
 
@@ -390,6 +392,128 @@ namespace boost {
                     result = accum;
                 }
 
+                // Adds the full product x * y to 'accum' without any reduction. The accumulator has a spare limb,
+                // so at least 2^limb_bits products of numbers lesser than the modulus fit in it.
+                BOOST_MP_CXX14_CONSTEXPR void multiply_accumulate(Backend_doubled_padded_limbs &accum, const Backend &x,
+                                                                  const Backend &y) const {
+                    if constexpr (is_trivial_cpp_int_modular<Backend>::value) {
+                        Backend_doubled_padded_limbs prod(x), y_padded(y);
+                        eval_multiply(prod, y_padded);
+                        eval_add(accum, prod);
+                    } else {
+                        constexpr std::size_t accum_size = Backend_doubled_padded_limbs::internal_limb_count;
+
+                        auto* accum_limbs = accum.limbs();
+                        auto* x_limbs = x.limbs();
+                        auto* y_limbs = y.limbs();
+
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            internal_limb_type carry = 0;
+                            for (std::size_t j = 0; j < limbs_count; ++j) {
+                                internal_double_limb_type t =
+                                    static_cast<internal_double_limb_type>(x_limbs[i]) * y_limbs[j] +
+                                    accum_limbs[i + j] + carry;
+                                accum_limbs[i + j] = static_cast<internal_limb_type>(t);
+                                carry = static_cast<internal_limb_type>(t >> limb_bits);
+                            }
+                            for (std::size_t k = i + limbs_count; carry != 0 && k < accum_size; ++k) {
+                                internal_double_limb_type t =
+                                    static_cast<internal_double_limb_type>(accum_limbs[k]) + carry;
+                                accum_limbs[k] = static_cast<internal_limb_type>(t);
+                                carry = static_cast<internal_limb_type>(t >> limb_bits);
+                            }
+                        }
+                    }
+                }
+
+                // Adds x * 2^(limbs * limb_bits) to 'accum'. For x in Montgomery form, that is the product of x and
+                // the Montgomery form of one, added with a single addition instead of a multiplication.
+                BOOST_MP_CXX14_CONSTEXPR void montgomery_add_accumulate(Backend_doubled_padded_limbs &accum,
+                                                                        const Backend &x) const {
+                    if constexpr (is_trivial_cpp_int_modular<Backend>::value) {
+                        Backend_doubled_padded_limbs shifted(x);
+                        eval_left_shift(shifted, m_mod.size() * limb_bits);
+                        eval_add(accum, shifted);
+                    } else {
+                        constexpr std::size_t accum_size = Backend_doubled_padded_limbs::internal_limb_count;
+
+                        auto* accum_limbs = accum.limbs();
+                        auto* x_limbs = x.limbs();
+
+                        internal_limb_type carry = 0;
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            internal_double_limb_type t =
+                                static_cast<internal_double_limb_type>(accum_limbs[limbs_count + i]) + x_limbs[i] +
+                                carry;
+                            accum_limbs[limbs_count + i] = static_cast<internal_limb_type>(t);
+                            carry = static_cast<internal_limb_type>(t >> limb_bits);
+                        }
+                        for (std::size_t k = 2 * limbs_count; carry != 0 && k < accum_size; ++k) {
+                            internal_double_limb_type t =
+                                static_cast<internal_double_limb_type>(accum_limbs[k]) + carry;
+                            accum_limbs[k] = static_cast<internal_limb_type>(t);
+                            carry = static_cast<internal_limb_type>(t >> limb_bits);
+                        }
+                    }
+                }
+
+                // Reduces a sum of products of numbers in Montgomery form, accumulated with multiply_accumulate,
+                // into the Montgomery form of the sum. 'accum' is destroyed.
+                // Unlike montgomery_reduce the input may be much larger than m * 2^(limbs * limb_bits), so the
+                // result of the Montgomery reduction is at most accum / 2^(limbs * limb_bits) + m, and is reduced
+                // further with Barrett reduction.
+                BOOST_MP_CXX14_CONSTEXPR void montgomery_reduce_accumulator(Backend &result,
+                                                                            Backend_doubled_padded_limbs &accum) const {
+                    Backend_padded_limbs reduced;
+                    if constexpr (is_trivial_cpp_int_modular<Backend>::value) {
+                        Backend_doubled_padded_limbs prod;
+                        for (size_t i = 0; i < m_mod.size(); ++i) {
+                            internal_limb_type limb_accum = custom_get_limb_value<internal_limb_type>(accum, i);
+                            double_limb_type mult_res = limb_accum *
+                                              /// to prevent overflow error in constexpr
+                                              static_cast<double_limb_type>(m_montgomery_p_dash);
+                            internal_limb_type mult_res_limb = static_cast<internal_limb_type>(mult_res);
+
+                            eval_multiply(prod, m_mod, mult_res_limb);
+                            eval_left_shift(prod, i * limb_bits);
+                            eval_add(accum, prod);
+                        }
+                        custom_right_shift(accum, m_mod.size() * limb_bits);
+                        reduced = accum;
+                    } else {
+                        constexpr std::size_t accum_size = Backend_doubled_padded_limbs::internal_limb_count;
+
+                        auto* accum_limbs = accum.limbs();
+                        auto* mod_limbs = m_mod.limbs();
+
+                        // accum += u_i * m * 2^(i * limb_bits), where u_i is chosen to zero the i-th limb.
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            internal_limb_type u_i = accum_limbs[i] * m_montgomery_p_dash;
+                            internal_limb_type carry = 0;
+                            for (std::size_t j = 0; j < limbs_count; ++j) {
+                                internal_double_limb_type t =
+                                    static_cast<internal_double_limb_type>(u_i) * mod_limbs[j] +
+                                    accum_limbs[i + j] + carry;
+                                accum_limbs[i + j] = static_cast<internal_limb_type>(t);
+                                carry = static_cast<internal_limb_type>(t >> limb_bits);
+                            }
+                            for (std::size_t k = i + limbs_count; carry != 0 && k < accum_size; ++k) {
+                                internal_double_limb_type t =
+                                    static_cast<internal_double_limb_type>(accum_limbs[k]) + carry;
+                                accum_limbs[k] = static_cast<internal_limb_type>(t);
+                                carry = static_cast<internal_limb_type>(t >> limb_bits);
+                            }
+                        }
+
+                        // The lower limbs are zero now, take the upper ones.
+                        auto* reduced_limbs = reduced.limbs();
+                        for (std::size_t i = 0; i < Backend_padded_limbs::internal_limb_count; ++i) {
+                            reduced_limbs[i] = accum_limbs[limbs_count + i];
+                        }
+                    }
+                    barrett_reduce(result, reduced);
+                }
+
                 template<unsigned Bits1, unsigned Bits2,
                     // result should fit in the output parameter
                     typename = typename boost::enable_if_c<Bits1 >= Bits2>::type>
@@ -425,6 +549,9 @@ namespace boost {
                         Backend &result, const Backend &y,
                         std::integral_constant<bool, false> const&) const {
 
+                    if (montgomery_mul_adx(result, y))
+                        return;
+
                     if ( m_no_carry_montgomery_mul_allowed ) 
                         montgomery_mul_no_carry_impl( 
                                 result, 
@@ -436,6 +563,41 @@ namespace boost {
                                 std::integral_constant<bool, false>() );
                 }
 
+                // Same as montgomery_mul, but the algorithm is chosen at compile time. Used by the modular
+                // params known at compile time, for which NoCarry is precomputed with
+                // is_applicable_for_no_carry_montgomery_mul(), so no flag is checked on each multiplication.
+                template<bool NoCarry>
+                BOOST_MP_CXX14_CONSTEXPR void montgomery_mul_ct(Backend &result, const Backend &y) const {
+                    if constexpr (is_trivial_cpp_int_modular<Backend>::value) {
+                        montgomery_mul(result, y, std::integral_constant<bool, true>());
+                    } else {
+                        if (montgomery_mul_adx(result, y))
+                            return;
+
+                        if constexpr (NoCarry) {
+                            montgomery_mul_no_carry_impl(result, y);
+                        } else {
+                            montgomery_mul_CIOS_impl(result, y, std::integral_constant<bool, false>());
+                        }
+                    }
+                }
+
+                // Runs the MULX/ADX kernel for 4 limbs of 64 bits if the target supports it, see
+                // montgomery_mul_adx.hpp. Returns false if the generic code must be used, which is always
+                // the case during constant evaluation.
+                BOOST_MP_CXX14_CONSTEXPR bool montgomery_mul_adx(Backend &result, const Backend &y) const {
+#if defined(CRYPTO3_MP_MONTGOMERY_MUL_ADX) && !defined(BOOST_MP_NO_CONSTEXPR_DETECTION)
+                    if constexpr (!is_trivial_cpp_int_modular<Backend>::value && limbs_count == 4 && limb_bits == 64) {
+                        if (!BOOST_MP_IS_CONST_EVALUATED(result.limbs())) {
+                            detail::montgomery_mul_4_limbs_adx(result.limbs(), result.limbs(), y.limbs(),
+                                                               m_mod.limbs(), m_montgomery_p_dash);
+                            return true;
+                        }
+                    }
+#endif
+                    return false;
+                }
+
                 void montgomery_mul(Backend &result, const Backend &y, std::integral_constant<bool, true> const&) const {
                      montgomery_mul_CIOS_impl(
                          result, 
@@ -443,6 +605,17 @@ namespace boost {
                          std::integral_constant<bool, true>() );
                 }
 
+                // Goldilocks prime 2^64 - 2^32 + 1 has a special form which allows a reduction without
+                // multiplications, see goldilocks64_arithmetic.hpp. Only evaluated at compile time, by
+                // modular_params_ct, so the arithmetic itself never checks the modulus.
+                BOOST_MP_CXX14_CONSTEXPR bool is_goldilocks64_modulus() const {
+                    if constexpr (Bits == 64) {
+                        return *m_mod.limbs() == goldilocks64::modulus;
+                    } else {
+                        return false;
+                    }
+                }
+
                 // Given a value represented in 'double_limb_type', decomposes it into
                 // two 'limb_type' variables, based on high order bits and low order bits.
                 // There 'a' receives high order bits of 'X', and 'b' receives the low order bits.
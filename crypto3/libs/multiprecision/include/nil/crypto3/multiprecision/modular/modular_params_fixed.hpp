@@ -35,6 +35,8 @@ namespace boost {
             public:
                 typedef typename policy_type::internal_limb_type internal_limb_type;
                 typedef typename policy_type::Backend_doubled_limbs Backend_doubled_limbs;
+                // Holds sums of products of numbers lesser than the modulus, see mod_multiply_accumulate.
+                typedef typename policy_type::Backend_doubled_padded_limbs accumulator_type;
                 // typedef typename policy_type::Backend Backend;
 
                 BOOST_MP_CXX14_CONSTEXPR auto &get_mod_obj() {
@@ -132,11 +134,62 @@ namespace boost {
                     }
                 }
 
+                // Same as mod_mul, for the modulus known at compile time: both the reduction and the Montgomery
+                // multiplication algorithm are selected with template parameters, see modular_params_ct.
+                template<bool IsOddMod, bool NoCarryMontgomeryMul, bool IsGoldilocks64, typename Backend1>
+                BOOST_MP_CXX14_CONSTEXPR void mod_mul_ct(Backend1 &result, const Backend1 &y) const {
+                    if constexpr (IsGoldilocks64) {
+                        *result.limbs() = goldilocks64::montgomery_mul(*result.limbs(), *y.limbs());
+                    } else if constexpr (IsOddMod) {
+                        m_mod_obj.template montgomery_mul_ct<NoCarryMontgomeryMul>(result, y);
+                    } else {
+                        m_mod_obj.regular_mul(result, y);
+                    }
+                }
+
+                // Lazy reduction for sums of products: accum += x * y without reduction, x and y are in the same
+                // form as the values of modular_adaptor. Reduce with mod_reduce_accumulator once all the products
+                // are added, which costs about as much as a single mod_mul.
+                BOOST_MP_CXX14_CONSTEXPR void mod_multiply_accumulate(accumulator_type &accum, const Backend &x,
+                                                                      const Backend &y) const {
+                    m_mod_obj.multiply_accumulate(accum, x, y);
+                }
+
+                // accum += x without reduction, x is in the same form as the values of modular_adaptor. The sum of
+                // products of Montgomery forms is scaled by one more 2^(limbs * limb_bits) than x, so x is added
+                // shifted by it.
+                BOOST_MP_CXX14_CONSTEXPR void mod_add_accumulate(accumulator_type &accum, const Backend &x) const {
+                    if (is_odd_mod) {
+                        m_mod_obj.montgomery_add_accumulate(accum, x);
+                    } else {
+                        accumulator_type x_padded(x);
+                        eval_add(accum, x_padded);
+                    }
+                }
+
+                BOOST_MP_CXX14_CONSTEXPR void mod_reduce_accumulator(Backend &result, accumulator_type &accum) const {
+                    if (is_odd_mod) {
+                        m_mod_obj.montgomery_reduce_accumulator(result, accum);
+                    } else {
+                        m_mod_obj.barrett_reduce(result, accum);
+                    }
+                }
+
                 template<typename Backend1, typename Backend2>
                 BOOST_MP_CXX14_CONSTEXPR void mod_add(Backend1 &result, const Backend2 &y) const {
                     m_mod_obj.regular_add(result, y);
                 }
 
+                // Same as mod_add, for the modulus known at compile time, see modular_params_ct.
+                template<bool IsGoldilocks64, typename Backend1>
+                BOOST_MP_CXX14_CONSTEXPR void mod_add_ct(Backend1 &result, const Backend1 &y) const {
+                    if constexpr (IsGoldilocks64) {
+                        *result.limbs() = goldilocks64::add(*result.limbs(), *y.limbs());
+                    } else {
+                        m_mod_obj.regular_add(result, y);
+                    }
+                }
+
                 template<typename Backend1>
                 BOOST_MP_CXX14_CONSTEXPR operator Backend1() {
                     return get_mod();
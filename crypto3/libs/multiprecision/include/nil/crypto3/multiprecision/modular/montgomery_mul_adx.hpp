@@ -0,0 +1,97 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MULTIPRECISION_MODULAR_MONTGOMERY_MUL_ADX_HPP
+#define CRYPTO3_MULTIPRECISION_MODULAR_MONTGOMERY_MUL_ADX_HPP
+
+// Montgomery multiplication for 4 limbs of 64 bits with the x86-64 MULX/ADCX/ADOX instructions.
+// Enabled when the compiler targets BMI2 and ADX, e.g. with -march=native on Broadwell and later.
+#if defined(__x86_64__) && defined(__BMI2__) && defined(__ADX__) && !defined(CRYPTO3_MP_DISABLE_ADX)
+#define CRYPTO3_MP_MONTGOMERY_MUL_ADX
+
+#include <immintrin.h>
+
+namespace boost {
+    namespace multiprecision {
+        namespace backends {
+            namespace detail {
+                typedef unsigned long long adx_limb_type;
+
+                // t[0..5] += x * y[0..3], t[5] receives the carries only.
+                // MULX does not touch the flags, so the low halves of the products are accumulated on one carry
+                // chain and the high halves on the other, which allows the CPU to run them interleaved.
+                inline void montgomery_mul_adx_row(adx_limb_type t[6], adx_limb_type x, const adx_limb_type y[4]) {
+                    adx_limb_type lo[4], hi[4];
+                    lo[0] = _mulx_u64(x, y[0], &hi[0]);
+                    lo[1] = _mulx_u64(x, y[1], &hi[1]);
+                    lo[2] = _mulx_u64(x, y[2], &hi[2]);
+                    lo[3] = _mulx_u64(x, y[3], &hi[3]);
+
+                    unsigned char c_lo = _addcarryx_u64(0, t[0], lo[0], &t[0]);
+                    c_lo = _addcarryx_u64(c_lo, t[1], lo[1], &t[1]);
+                    c_lo = _addcarryx_u64(c_lo, t[2], lo[2], &t[2]);
+                    c_lo = _addcarryx_u64(c_lo, t[3], lo[3], &t[3]);
+                    c_lo = _addcarryx_u64(c_lo, t[4], 0, &t[4]);
+
+                    unsigned char c_hi = _addcarryx_u64(0, t[1], hi[0], &t[1]);
+                    c_hi = _addcarryx_u64(c_hi, t[2], hi[1], &t[2]);
+                    c_hi = _addcarryx_u64(c_hi, t[3], hi[2], &t[3]);
+                    c_hi = _addcarryx_u64(c_hi, t[4], hi[3], &t[4]);
+
+                    t[5] += static_cast<adx_limb_type>(c_lo) + c_hi;
+                }
+
+                // result = a * b * 2^-256 mod m for a, b < m, where m is odd and p_dash = -m^-1 mod 2^64.
+                // Coarsely integrated operand scanning, works for any modulus of 4 limbs, including the ones
+                // with the most significant bit set. 'result' may alias 'a' or 'b'.
+                template<typename Limb>
+                inline void montgomery_mul_4_limbs_adx(Limb *result, const Limb *a, const Limb *b, const Limb *m,
+                                                       Limb p_dash) {
+                    static_assert(sizeof(Limb) == sizeof(adx_limb_type), "the kernel works on 64-bit limbs only");
+
+                    const adx_limb_type x[4] = {a[0], a[1], a[2], a[3]};
+                    const adx_limb_type y[4] = {b[0], b[1], b[2], b[3]};
+                    const adx_limb_type mod[4] = {m[0], m[1], m[2], m[3]};
+                    // t < 2m after every iteration, so t[4] is at most 1 and t[5] is 0 before the next one.
+                    adx_limb_type t[6] = {0, 0, 0, 0, 0, 0};
+
+                    for (int i = 0; i < 4; ++i) {
+                        montgomery_mul_adx_row(t, y[i], x);
+
+                        // t += (t[0] * p_dash mod 2^64) * m, which makes t[0] zero, then t >>= 64.
+                        montgomery_mul_adx_row(t, t[0] * p_dash, mod);
+                        t[0] = t[1];
+                        t[1] = t[2];
+                        t[2] = t[3];
+                        t[3] = t[4];
+                        t[4] = t[5];
+                        t[5] = 0;
+                    }
+
+                    // Subtract the modulus if t >= m, t[4] is the bit above the 4 limbs.
+                    adx_limb_type d[4];
+                    unsigned char borrow = _subborrow_u64(0, t[0], mod[0], &d[0]);
+                    borrow = _subborrow_u64(borrow, t[1], mod[1], &d[1]);
+                    borrow = _subborrow_u64(borrow, t[2], mod[2], &d[2]);
+                    borrow = _subborrow_u64(borrow, t[3], mod[3], &d[3]);
+                    borrow = _subborrow_u64(borrow, t[4], 0, &t[4]);
+
+                    // No borrow means t >= m.
+                    const adx_limb_type mask = static_cast<adx_limb_type>(borrow) - 1u;
+                    for (int j = 0; j < 4; ++j) {
+                        result[j] = static_cast<Limb>((d[j] & mask) | (t[j] & ~mask));
+                    }
+                }
+            }    // namespace detail
+        }    // namespace backends
+    }   // namespace multiprecision
+}   // namespace boost
+
+#endif
+
+#endif    // CRYPTO3_MULTIPRECISION_MODULAR_MONTGOMERY_MUL_ADX_HPP
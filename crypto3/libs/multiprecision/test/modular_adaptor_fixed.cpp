@@ -41,6 +41,7 @@ using boost::multiprecision::backends::cpp_int_modular_backend;
 using boost::multiprecision::backends::modular_adaptor;
 using boost::multiprecision::backends::modular_params;
 using boost::multiprecision::backends::modular_params_rt;
+using boost::multiprecision::backends::modular_params_ct;
 
 enum test_set_enum : std::size_t {
     mod_e,
@@ -474,6 +475,46 @@ BOOST_AUTO_TEST_CASE(base_ops_odd_mod_backend_17) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+// Multiplication with the modulus known at compile time selects the Montgomery algorithm statically,
+// it must agree with the runtime selection.
+template<typename Backend, const modular_params<Backend> &Modulus>
+void compile_time_modulus_multiplication_test(const boost::multiprecision::number<Backend> &x_standard) {
+    using modular_adaptor_ct_type = modular_adaptor<Backend, modular_params_ct<Backend, Modulus>>;
+    using modular_number_ct = boost::multiprecision::number<modular_adaptor_ct_type>;
+    using modular_adaptor_rt_type = modular_adaptor<Backend, modular_params_rt<Backend>>;
+    using modular_number_rt = boost::multiprecision::number<modular_adaptor_rt_type>;
+
+    modular_number_ct x_ct(modular_adaptor_ct_type(x_standard.backend())),
+        acc_ct(modular_adaptor_ct_type(x_standard.backend()));
+    modular_number_rt x_rt(modular_adaptor_rt_type(x_standard.backend(), Modulus)),
+        acc_rt(modular_adaptor_rt_type(x_standard.backend(), Modulus));
+    for (std::size_t i = 0; i < 100; ++i) {
+        acc_ct *= x_ct;
+        acc_ct *= acc_ct;
+        acc_rt *= x_rt;
+        acc_rt *= acc_rt;
+        BOOST_CHECK(acc_ct.backend().convert_to_cpp_int() == acc_rt.backend().convert_to_cpp_int());
+    }
+}
+
+// The most significant bit is set, so the general CIOS algorithm is used.
+constexpr modular_params<cpp_int_modular_backend<256>> secp256k1_modulus_params =
+    0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_cppui_modular256;
+// Pallas base field modulus, allows the no-carry algorithm.
+constexpr modular_params<cpp_int_modular_backend<255>> pallas_modulus_params =
+    0x40000000000000000000000000000000224698fc094cf91b992d30ed00000001_cppui_modular255;
+
+BOOST_AUTO_TEST_SUITE(compile_time_modulus_tests)
+
+BOOST_AUTO_TEST_CASE(compile_time_modulus_multiplication) {
+    compile_time_modulus_multiplication_test<cpp_int_modular_backend<256>, secp256k1_modulus_params>(
+        0xb5d724ce6f44c3c587867bbcb417e9eb6fa05e7e2ef029166568f14eb3161387_cppui_modular256);
+    compile_time_modulus_multiplication_test<cpp_int_modular_backend<255>, pallas_modulus_params>(
+        0x2bf1d3ba03e0f5a0e8e8f45e1c2e6b9f30c16f0e3b0a9a6f7ee2c1f40de5a5d1_cppui_modular255);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE(runtime_tests)
 
 BOOST_AUTO_TEST_CASE(secp256k1_incorrect_multiplication) {
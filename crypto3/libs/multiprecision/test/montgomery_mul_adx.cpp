@@ -0,0 +1,144 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE montgomery_mul_adx_test
+
+// See modular_adaptor_fixed.cpp, BOOST_MP_ASSERT is not constexpr.
+#ifndef BOOST_MP_DETAIL_ASSERT_HPP
+    #define BOOST_MP_DETAIL_ASSERT_HPP
+    #define BOOST_MP_ASSERT(expr) ((void)0)
+    #define BOOST_MP_ASSERT_MSG(expr, msg) ((void)0)
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// We need cpp_int to compare to it.
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+#include <nil/crypto3/multiprecision/cpp_int_modular/literals.hpp>
+
+#include <nil/crypto3/multiprecision/modular/modular_functions_fixed.hpp>
+
+using namespace boost::multiprecision;
+
+using boost::multiprecision::backends::cpp_int_modular_backend;
+using boost::multiprecision::backends::modular_functions_fixed;
+
+using backend_type = cpp_int_modular_backend<256>;
+
+cpp_int to_cpp_int(const backend_type &x) {
+    cpp_int result = 0;
+    for (int i = 3; i >= 0; --i) {
+        result <<= 64;
+        result |= x.limbs()[i];
+    }
+    return result;
+}
+
+backend_type from_cpp_int(cpp_int x) {
+    backend_type result;
+    for (std::size_t i = 0; i < 4; ++i) {
+        result.limbs()[i] = static_cast<std::uint64_t>(x & 0xFFFFFFFFFFFFFFFFULL);
+        x >>= 64;
+    }
+    return result;
+}
+
+#ifdef CRYPTO3_MP_MONTGOMERY_MUL_ADX
+
+// Checks the MULX/ADX kernel against the portable CIOS multiplication and against a * b * 2^-256 mod m
+// computed with cpp_int.
+void montgomery_mul_adx_test(const backend_type &m, std::size_t random_runs) {
+    const modular_functions_fixed<backend_type> mod_obj(m);
+    const cpp_int m_int = to_cpp_int(m);
+
+    // Values next to 0 and the modulus are multiplied by all the others, random values in pairs.
+    std::vector<cpp_int> values = {0, 1, 2, m_int - 1, m_int - 2, (m_int - 1) / 2};
+    const std::size_t edge_values_amount = values.size();
+    std::mt19937_64 generator(m.limbs()[0]);
+    for (std::size_t i = 0; i < random_runs; ++i) {
+        cpp_int value = 0;
+        for (std::size_t j = 0; j < 4; ++j) {
+            value = (value << 64) | generator();
+        }
+        values.push_back(value % m_int);
+    }
+
+    const auto check = [&](const cpp_int &a_int, const cpp_int &b_int) {
+        const backend_type a = from_cpp_int(a_int), b = from_cpp_int(b_int);
+
+        backend_type adx_result;
+        boost::multiprecision::backends::detail::montgomery_mul_4_limbs_adx(
+            adx_result.limbs(), a.limbs(), b.limbs(), m.limbs(), mod_obj.get_p_dash());
+
+        backend_type portable_result = a;
+        mod_obj.montgomery_mul_CIOS_impl(portable_result, b, std::integral_constant<bool, false>());
+
+        const cpp_int adx_int = to_cpp_int(adx_result);
+        BOOST_CHECK_EQUAL(adx_int, to_cpp_int(portable_result));
+        BOOST_CHECK(adx_int < m_int);
+        BOOST_CHECK_EQUAL((adx_int << 256) % m_int, a_int * b_int % m_int);
+    };
+    for (std::size_t i = 0; i < edge_values_amount; ++i) {
+        for (const auto &value : values) {
+            check(values[i], value);
+        }
+    }
+    for (std::size_t i = edge_values_amount; i + 1 < values.size(); ++i) {
+        check(values[i], values[i + 1]);
+    }
+}
+
+bool cpu_supports_adx() {
+    return __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx");
+}
+
+BOOST_AUTO_TEST_SUITE(montgomery_mul_adx_tests)
+
+BOOST_AUTO_TEST_CASE(montgomery_mul_adx_top_bit_set) {
+    if (!cpu_supports_adx()) {
+        BOOST_TEST_MESSAGE("The CPU does not support BMI2 and ADX, skipping");
+        return;
+    }
+    // secp256k1 base and scalar fields.
+    montgomery_mul_adx_test(
+        0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_cppui_modular256.backend(), 1000);
+    montgomery_mul_adx_test(
+        0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141_cppui_modular256.backend(), 1000);
+    // secp256r1 base field.
+    montgomery_mul_adx_test(
+        0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff_cppui_modular256.backend(), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(montgomery_mul_adx_top_bit_clear) {
+    if (!cpu_supports_adx()) {
+        BOOST_TEST_MESSAGE("The CPU does not support BMI2 and ADX, skipping");
+        return;
+    }
+    // alt_bn128 base field and pallas base field.
+    montgomery_mul_adx_test(
+        0x30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47_cppui_modular256.backend(), 1000);
+    montgomery_mul_adx_test(
+        0x40000000000000000000000000000000224698fc094cf91b992d30ed00000001_cppui_modular256.backend(), 1000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#else
+
+BOOST_AUTO_TEST_CASE(montgomery_mul_adx_disabled) {
+    BOOST_TEST_MESSAGE("The MULX/ADX kernel is not enabled for this target");
+}
+
+#endif
@@ -397,6 +397,64 @@ namespace nil {
                     return (x_index + domain_size / FRI::m) % domain_size;
                 }
 
+                // Fills 's_indices' with the pairs of evaluation indices stored in the leaf 'x_index', in the order
+                // they are written to the leaf. 's_indices' must have coset_size / FRI::m entries.
+                template<typename FRI>
+                static inline void get_leaf_indices(const std::size_t x_index, const std::size_t domain_size,
+                                                    std::vector<std::array<std::size_t, FRI::m>> &s_indices) {
+                    s_indices[0][0] = x_index;
+                    s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
+
+                    std::size_t base_index = domain_size / (FRI::m * FRI::m);
+                    std::size_t prev_half_size = 1;
+                    std::size_t i = 1;
+                    while (i < s_indices.size()) {
+                        for (std::size_t j = 0; j < prev_half_size; j++) {
+                            s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
+                            s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
+                            i++;
+                        }
+                        base_index /= FRI::m;
+                        prev_half_size <<= 1;
+                    }
+                }
+
+                /**
+                 * Commits to 'list_size' polynomials of size 'domain_size', one leaf per coset with the evaluations
+                 * of all the polynomials. Leaves are serialized into a scratch buffer and hashed right away, so
+                 * only one leaf per thread is in memory instead of a copy of all the evaluations.
+                 */
+                template<typename FRI>
+                static typename FRI::precommitment_type
+                precommit_cosets(const math::polynomial_dfs<typename FRI::field_type::value_type> *poly,
+                                 const std::size_t list_size, const std::size_t domain_size, const std::size_t fri_step) {
+                    typedef typename FRI::merkle_tree_type::value_type digest_type;
+
+                    std::size_t coset_size = 1 << fri_step;
+                    std::size_t leafs_number = domain_size / coset_size;
+
+                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(
+                        leafs_number,
+                        [poly, list_size, domain_size, coset_size](std::size_t begin, std::size_t end, auto out) {
+                            detail::fri_field_element_consumer<FRI> element_consumer(coset_size * list_size);
+                            std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
+
+                            for (std::size_t x_index = begin; x_index < end; ++x_index, ++out) {
+                                get_leaf_indices<FRI>(x_index, domain_size, s_indices);
+
+                                element_consumer.reset_cursor();
+                                for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
+                                    for (const auto &pair : s_indices) {
+                                        element_consumer.consume(poly[polynom_index][pair[0]]);
+                                        element_consumer.consume(poly[polynom_index][pair[1]]);
+                                    }
+                                }
+                                *out = static_cast<digest_type>(
+                                    crypto3::hash<typename FRI::merkle_tree_hash_type>(element_consumer));
+                            }
+                        });
+                }
+
                 template<typename FRI,
                     typename std::enable_if<
                         std::is_base_of<
@@ -416,43 +474,7 @@ namespace nil {
                         throw std::runtime_error("Polynomial size does not match the domain size in FRI precommit.");
                     }
 
-                    std::size_t domain_size = D->size();
-                    std::size_t coset_size = 1 << fri_step;
-                    std::size_t leafs_number = domain_size / coset_size;
-                    std::vector<detail::fri_field_element_consumer<FRI>> y_data(
-                        leafs_number,
-                        detail::fri_field_element_consumer<FRI>(coset_size)
-                    );
-
-                    for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
-                        std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                        s_indices[0][0] = x_index;
-                        s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                        auto& element_consumer = y_data[x_index].reset_cursor();
-                        element_consumer.consume(f[s_indices[0][0]]);
-                        element_consumer.consume(f[s_indices[0][1]]);
-
-                        std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                        std::size_t prev_half_size = 1;
-                        std::size_t i = 1;
-                        while (i < coset_size / FRI::m) {
-                            for (std::size_t j = 0; j < prev_half_size; j++) {
-                                s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-
-                                element_consumer.consume(f[s_indices[i][0]]);
-                                element_consumer.consume(f[s_indices[i][1]]);
-
-                                i++;
-                            }
-                            base_index /= FRI::m;
-                            prev_half_size <<= 1;
-                        }
-                    }
-
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                    return precommit_cosets<FRI>(&f, 1, D->size(), fri_step);
                 }
 
                 template<typename FRI,
@@ -506,45 +528,7 @@ namespace nil {
                         }
                     }
 
-                    std::size_t domain_size = D->size();
-                    std::size_t list_size = poly.size();
-                    std::size_t coset_size = 1 << fri_step;
-                    std::size_t leafs_number = domain_size / coset_size;
-                    std::vector<detail::fri_field_element_consumer<FRI>> y_data(
-                        leafs_number,
-                        detail::fri_field_element_consumer<FRI>(coset_size * list_size)
-                    );
-
-                    for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
-                        auto& element_consumer = y_data[x_index].reset_cursor();
-                        for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
-                            std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                            s_indices[0][0] = x_index;
-                            s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                            element_consumer.consume(poly[polynom_index][s_indices[0][0]]);
-                            element_consumer.consume(poly[polynom_index][s_indices[0][1]]);
-
-                            std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                            std::size_t prev_half_size = 1;
-                            std::size_t i = 1;
-                            while (i < coset_size / FRI::m) {
-                                for (std::size_t j = 0; j < prev_half_size; j++) {
-                                    s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                    s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][0]]);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][1]]);
-
-                                    i++;
-                                }
-                                base_index /= FRI::m;
-                                prev_half_size <<= 1;
-                            }
-                        }
-                    }
-
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                    return precommit_cosets<FRI>(poly.data(), poly.size(), D->size(), fri_step);
                 }
 
                 template<typename FRI, typename ContainerType,
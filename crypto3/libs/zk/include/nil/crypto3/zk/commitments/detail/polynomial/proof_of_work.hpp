@@ -61,10 +61,10 @@ namespace nil {
                         output_type proof_of_work = std::rand();
                         output_type result;
 
+                        const typename transcript_type::midstate_type midstate = transcript.midstate();
                         while( true ) {
-                            transcript_type tmp_transcript = transcript;
-                            tmp_transcript(to_byte_array(proof_of_work));
-                            result = tmp_transcript.template int_challenge<output_type>();
+                            result = transcript_type::template int_challenge_from_midstate<output_type>(
+                                midstate, to_byte_array(proof_of_work));
                             if ((result & mask) == 0)
                                 break;
                             proof_of_work++;
@@ -106,10 +106,10 @@ namespace nil {
                                 ((integral_type(1) << GrindingBits) - 1) << (FieldType::modulus_bits - GrindingBits)
                                 : 0);
 
+                        const typename transcript_type::midstate_type midstate = transcript.midstate();
                         while( true ) {
-                            transcript_type tmp_transcript = transcript;
-                            tmp_transcript(proof_of_work);
-                            result = integral_type(tmp_transcript.template challenge<FieldType>().data);
+                            result = integral_type(
+                                transcript_type::template challenge_from_midstate<FieldType>(midstate, proof_of_work).data);
                             if ((result & mask) == 0)
                                 break;
                             proof_of_work++;
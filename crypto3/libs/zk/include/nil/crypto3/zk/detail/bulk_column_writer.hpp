@@ -0,0 +1,78 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_DETAIL_BULK_COLUMN_WRITER_HPP
+#define CRYPTO3_ZK_DETAIL_BULK_COLUMN_WRITER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace detail {
+
+                // Writes table columns encoded in bulk. A column is encoded block by block into a contiguous buffer,
+                // and each block is written with a single call.
+                class bulk_column_writer {
+                public:
+                    // Rows encoded and written at once.
+                    static constexpr std::size_t block_rows = 1 << 16;
+
+                    explicit bulk_column_writer(std::ostream& out) : out_(out) {
+                    }
+
+                    bulk_column_writer(const bulk_column_writer&) = delete;
+                    bulk_column_writer& operator=(const bulk_column_writer&) = delete;
+
+                    // Writes 'rows' elements of 'element_size' bytes. encode_rows(begin, end, out) must encode rows
+                    // [begin, end) into out. An exception thrown by 'encode_rows' is rethrown here.
+                    template<typename EncodeRows>
+                    void write_column(std::size_t rows, std::size_t element_size, const EncodeRows& encode_rows) {
+                        for (std::size_t begin = 0; begin < rows; begin += block_rows) {
+                            const std::size_t end = std::min(rows, begin + block_rows);
+                            buffer_.resize((end - begin) * element_size);
+                            encode_rows(begin, end, buffer_.data());
+                            out_.write(reinterpret_cast<const char*>(buffer_.data()), buffer_.size());
+                        }
+                    }
+
+                    // Blocks are written synchronously, nothing is pending. Kept for the interface of the parallel
+                    // writer.
+                    void flush() {
+                    }
+
+                private:
+                    std::ostream& out_;
+                    std::vector<std::uint8_t> buffer_;
+                };
+
+            }    // namespace detail
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_DETAIL_BULK_COLUMN_WRITER_HPP
@@ -32,6 +32,7 @@
 #include <nil/crypto3/marshalling/algebra/types/curve_element.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_batch.hpp>
 #include <nil/crypto3/hash/keccak.hpp>
 #include <nil/crypto3/hash/poseidon.hpp>
 #include <nil/crypto3/hash/sha2.hpp>
@@ -173,19 +174,142 @@ namespace nil {
                         algebra::is_field_element<element>::value
                         >
                     operator()(element const& data) {
+                        std::vector<std::uint8_t> byte_data = element_bytes(data);
+                        auto acc_convertible = hash<hash_type>(state);
+                        state = accumulators::extract::hash<hash_type>(
+                                hash<hash_type>(byte_data, static_cast<accumulator_set<hash_type> &>(acc_convertible)));
+                    }
+
+                    typedef accumulator_set<hash_type> midstate_type;
+
+                    /*!
+                     * @brief Hash accumulator with the current state already absorbed.
+                     * Every operator() call starts by absorbing the state, so callers trying many different inputs
+                     * against the same transcript, like proof of work grinding, compute it once and pass it to
+                     * int_challenge_from_midstate or challenge_from_midstate instead of copying the transcript.
+                     */
+                    midstate_type midstate() const {
+                        auto acc_convertible = hash<hash_type>(state);
+                        return static_cast<accumulator_set<hash_type> &>(acc_convertible);
+                    }
+
+                    // Same as operator()(r) followed by int_challenge<Integral>() on the transcript 'acc' was taken from.
+                    template<typename Integral, typename InputRange>
+                    static Integral int_challenge_from_midstate(midstate_type acc, const InputRange &r) {
+                        typename hash_type::digest_type next_state =
+                            accumulators::extract::hash<hash_type>(hash<hash_type>(r, acc));
+                        return int_challenge_from_state<Integral>(next_state);
+                    }
+
+                    /*!
+                     * @brief Same as int_challenge_from_midstate<Integral>(midstate(), inputs[i]) for every i.
+                     * All the inputs are hashed together with hash_batch, so Keccak transcripts process several
+                     * of them at once with SIMD, which is what proof of work grinding spends its time on.
+                     */
+                    template<typename Integral, std::size_t InputSize, std::size_t Count>
+                    std::array<Integral, Count> int_challenges_batch(
+                            const std::array<std::array<std::uint8_t, InputSize>, Count> &inputs) const {
+                        constexpr std::size_t state_size = hash_type::digest_bits / 8;
+                        BOOST_ASSERT(state.size() == state_size);
+
+                        std::array<std::array<std::uint8_t, state_size + InputSize>, Count> messages;
+                        std::array<const std::uint8_t *, Count> message_pointers;
+                        for (std::size_t i = 0; i < Count; ++i) {
+                            std::copy(state.begin(), state.end(), messages[i].begin());
+                            std::copy(inputs[i].begin(), inputs[i].end(), messages[i].begin() + state_size);
+                            message_pointers[i] = messages[i].data();
+                        }
+                        std::array<typename hash_type::digest_type, Count> next_states;
+                        hash_batch<hash_type>(message_pointers.data(), state_size + InputSize, Count,
+                                              next_states.data());
+
+                        // int_challenge_from_state hashes the state once more before taking the challenge from it.
+                        for (std::size_t i = 0; i < Count; ++i) {
+                            message_pointers[i] = next_states[i].data();
+                        }
+                        std::array<typename hash_type::digest_type, Count> challenge_states;
+                        hash_batch<hash_type>(message_pointers.data(), state_size, Count, challenge_states.data());
+
+                        std::array<Integral, Count> result;
+                        for (std::size_t i = 0; i < Count; ++i) {
+                            result[i] = int_challenge_from_hashed_state<Integral>(challenge_states[i]);
+                        }
+                        return result;
+                    }
+
+                    // Same as operator()(data) followed by challenge<Field>() on the transcript 'acc' was taken from.
+                    template<typename Field, typename element>
+                    static typename Field::value_type challenge_from_midstate(midstate_type acc, element const& data) {
+                        std::vector<std::uint8_t> byte_data = element_bytes(data);
+                        typename hash_type::digest_type next_state =
+                            accumulators::extract::hash<hash_type>(hash<hash_type>(byte_data, acc));
+                        return challenge_from_state<Field>(next_state);
+                    }
+
+                    template<typename Field>
+                    typename Field::value_type challenge() {
+                        return challenge_from_state<Field>(state);
+                    }
+
+                    template<typename Integral>
+                    Integral int_challenge() {
+                        return int_challenge_from_state<Integral>(state);
+                    }
+
+                    template<typename Field, std::size_t N>
+                    // typename std::enable_if<(Hash::digest_bits >= Field::modulus_bits),
+                    //                         std::array<typename Field::value_type, N>>::type
+                    std::array<typename Field::value_type, N> challenges() {
+
+                        std::array<typename Field::value_type, N> result;
+                        for (auto &ch : result) {
+                            ch = challenge<Field>();
+                        }
+
+                        return result;
+                    }
+
+                    template<typename Field>
+                    std::vector<typename Field::value_type> challenges(std::size_t N) {
+
+                        std::vector<typename Field::value_type> result;
+                        for (std::size_t i = 0; i < N; ++i) {
+                            result.push_back(challenge<Field>());
+                        }
+
+                        return result;
+                    }
+
+                private:
+                    template<typename element>
+                    static std::vector<std::uint8_t> element_bytes(element const& data) {
                         nil::marshalling::status_type status;
                         std::vector<std::uint8_t> byte_data =
                             nil::marshalling::pack<nil::marshalling::option::big_endian>(data, status);
                         THROW_IF_ERROR_STATUS(status, "fiat_shamir_heuristic_sequential::operator()");
-                        auto acc_convertible = hash<hash_type>(state);
-                        state = accumulators::extract::hash<hash_type>(
-                                hash<hash_type>(byte_data, static_cast<accumulator_set<hash_type> &>(acc_convertible)));
+                        return byte_data;
                     }
 
                     template<typename Field>
                     // typename std::enable_if<(Hash::digest_bits >= Field::modulus_bits),
                     //                         typename Field::value_type>::type
-                    typename Field::value_type challenge() {
+                    static typename Field::value_type challenge_from_state(typename hash_type::digest_type &state) {
+                        // Challenges from extension fields are sampled coordinate by coordinate, so proofs over
+                        // small fields get challenges of the full extension field size.
+                        if constexpr (algebra::is_extended_field_element<typename Field::value_type>::value) {
+                            typename Field::value_type::data_type data;
+                            for (auto &coordinate : data) {
+                                coordinate = challenge_from_state<typename Field::underlying_field_type>(state);
+                            }
+                            return typename Field::value_type(data);
+                        } else {
+                            return base_field_challenge_from_state<Field>(state);
+                        }
+                    }
+
+                    template<typename Field>
+                    static typename Field::value_type base_field_challenge_from_state(
+                            typename hash_type::digest_type &state) {
                         using digest_value_type = typename hash_type::digest_type::value_type;
                         const std::size_t digest_value_bits = sizeof(digest_value_type) * CHAR_BIT;
                         const std::size_t element_size = Field::number_bits / digest_value_bits +
@@ -207,8 +331,13 @@ namespace nil {
                     }
 
                     template<typename Integral>
-                    Integral int_challenge() {
+                    static Integral int_challenge_from_state(typename hash_type::digest_type &state) {
                         state = hash<hash_type>(state);
+                        return int_challenge_from_hashed_state<Integral>(state);
+                    }
+
+                    template<typename Integral>
+                    static Integral int_challenge_from_hashed_state(const typename hash_type::digest_type &state) {
                         nil::marshalling::status_type status;
                         boost::multiprecision::number<modular_backend_of_hash_size> raw_result = nil::marshalling::pack(state, status);
                         // If we remove the next line, raw_result is a much larger number, conversion to 'Integral' will overflow
@@ -217,31 +346,6 @@ namespace nil {
                         return static_cast<Integral>(raw_result);
                     }
 
-                    template<typename Field, std::size_t N>
-                    // typename std::enable_if<(Hash::digest_bits >= Field::modulus_bits),
-                    //                         std::array<typename Field::value_type, N>>::type
-                    std::array<typename Field::value_type, N> challenges() {
-
-                        std::array<typename Field::value_type, N> result;
-                        for (auto &ch : result) {
-                            ch = challenge<Field>();
-                        }
-
-                        return result;
-                    }
-
-                    template<typename Field>
-                    std::vector<typename Field::value_type> challenges(std::size_t N) {
-
-                        std::vector<typename Field::value_type> result;
-                        for (std::size_t i = 0; i < N; ++i) {
-                            result.push_back(challenge<Field>());
-                        }
-
-                        return result;
-                    }
-
-                private:
                     typename hash_type::digest_type state;
                 };
 
@@ -314,6 +418,36 @@ namespace nil {
                         sponge.absorb(hash<hash_type>(first, last));
                     }
 
+                    // The sponge already holds everything absorbed so far, so a copy of the transcript is the midstate.
+                    typedef fiat_shamir_heuristic_sequential midstate_type;
+
+                    midstate_type midstate() const {
+                        return *this;
+                    }
+
+                    template<typename Integral, typename InputRange>
+                    static Integral int_challenge_from_midstate(midstate_type transcript, const InputRange &r) {
+                        transcript(r);
+                        return transcript.template int_challenge<Integral>();
+                    }
+
+                    // The sponge has no multi-buffer path for this, the inputs are absorbed one by one.
+                    template<typename Integral, std::size_t InputSize, std::size_t Count>
+                    std::array<Integral, Count> int_challenges_batch(
+                            const std::array<std::array<std::uint8_t, InputSize>, Count> &inputs) const {
+                        std::array<Integral, Count> result;
+                        for (std::size_t i = 0; i < Count; ++i) {
+                            result[i] = int_challenge_from_midstate<Integral>(midstate(), inputs[i]);
+                        }
+                        return result;
+                    }
+
+                    template<typename Field, typename element>
+                    static typename Field::value_type challenge_from_midstate(midstate_type transcript, element const& data) {
+                        transcript(data);
+                        return transcript.template challenge<Field>();
+                    }
+
                     template<typename Field>
                     typename Field::value_type challenge() {
                         typename Field::value_type result = sponge.squeeze();
@@ -0,0 +1,112 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE bulk_column_writer_test
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/zk/detail/bulk_column_writer.hpp>
+
+namespace {
+    // Encodes the value of the row of a column as 8 little endian bytes.
+    std::uint64_t cell_value(std::size_t column, std::size_t row) {
+        return (std::uint64_t(column) << 40) ^ (row * 0x9E3779B97F4A7C15ull);
+    }
+
+    void encode_cell(std::uint64_t value, std::uint8_t* out) {
+        for (std::size_t i = 0; i < 8; ++i) {
+            out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+        }
+    }
+
+    std::string expected_column(std::size_t column, std::size_t rows) {
+        std::string result(rows * 8, '\0');
+        for (std::size_t row = 0; row < rows; ++row) {
+            encode_cell(cell_value(column, row), reinterpret_cast<std::uint8_t*>(&result[row * 8]));
+        }
+        return result;
+    }
+
+    auto column_encoder(std::size_t column) {
+        return [column](std::size_t begin, std::size_t end, std::uint8_t* out) {
+            for (std::size_t row = begin; row < end; ++row, out += 8) {
+                encode_cell(cell_value(column, row), out);
+            }
+        };
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(bulk_column_writer_test_suite)
+
+BOOST_AUTO_TEST_CASE(multiple_blocks_test) {
+    using nil::crypto3::zk::detail::bulk_column_writer;
+
+    // Not a multiple of the block size, so the last block is partial.
+    const std::size_t rows = 3 * bulk_column_writer::block_rows + 123;
+    const std::string header = "header";
+
+    std::ostringstream out;
+    {
+        bulk_column_writer writer(out);
+        writer.write_column(rows, 8, column_encoder(0));
+        writer.flush();
+        out << header;
+        writer.write_column(rows, 8, column_encoder(1));
+        writer.write_column(0, 8, column_encoder(2));
+    }
+    const std::string expected = expected_column(0, rows) + header + expected_column(1, rows);
+
+    BOOST_CHECK_EQUAL(out.str().size(), expected.size());
+    BOOST_CHECK(out.str() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(encode_exception_test) {
+    using nil::crypto3::zk::detail::bulk_column_writer;
+
+    const std::size_t rows = 2 * bulk_column_writer::block_rows;
+    const std::size_t failing_row = bulk_column_writer::block_rows + 5;
+
+    std::ostringstream out;
+    {
+        bulk_column_writer writer(out);
+        auto encode = [failing_row](std::size_t begin, std::size_t end, std::uint8_t* out) {
+            if (begin <= failing_row && failing_row < end) {
+                throw std::runtime_error("Can't encode the row");
+            }
+            column_encoder(0)(begin, end, out);
+        };
+        BOOST_CHECK_THROW(writer.write_column(rows, 8, encode), std::runtime_error);
+    }
+    // Only the first block, which was encoded before the failure, is written.
+    BOOST_CHECK(out.str() == expected_column(0, bulk_column_writer::block_rows));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -81,6 +81,7 @@
 #include <nil/marshalling/field_type.hpp>
 #include <nil/crypto3/marshalling/zk/types/plonk/constraint_system.hpp>
 #include <nil/crypto3/marshalling/zk/types/plonk/assignment_table.hpp>
+#include <nil/crypto3/marshalling/zk/types/plonk/columnar_assignment_table.hpp>
 
 #include "parsers.hpp"
 
@@ -137,6 +138,19 @@ std::optional<std::tuple<
             std::cerr << "Cannot parse input file: read failed." << std::endl;
             return std::nullopt;
         }
+        // The assigner and proof-producer write the columnar format by default.
+        if (nil::crypto3::marshalling::types::is_columnar_assignment_table(v.data(), v.size())) {
+            try {
+                std::tie(desc, assignment_table) =
+                    nil::crypto3::marshalling::types::make_columnar_assignment_table<AssignmentTableType>(
+                        v.data(), v.size()
+                    );
+            } catch (const std::invalid_argument &e) {
+                std::cerr << "Cannot parse input file: " << e.what() << std::endl;
+                return std::nullopt;
+            }
+            return std::make_tuple(desc, assignment_table);
+        }
         nil::crypto3::marshalling::types::plonk_assignment_table<TTypeBase, AssignmentTableType>
             marshalled_table_data;
         auto read_iter = v.begin();
@@ -27,8 +27,11 @@
 #ifndef CRYPTO3_MERKLE_TREE_HPP
 #define CRYPTO3_MERKLE_TREE_HPP
 
-#include <vector>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
 
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 
@@ -37,6 +40,7 @@
 
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_batch.hpp>
 #include <nil/crypto3/container/merkle/node.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
@@ -482,6 +486,116 @@ namespace nil {
                     return accumulators::extract::hash<T>(acc);
                 }
 
+                // Words of the messages hash_batch takes for Hash: bytes for Keccak, field elements for Poseidon.
+                template<typename Hash, typename = void>
+                struct hash_batch_word {
+                    typedef std::uint8_t type;
+                };
+
+                template<typename Hash>
+                struct hash_batch_word<Hash, std::enable_if_t<hashes::is_poseidon<Hash>::value>> {
+                    typedef typename Hash::word_type type;
+                };
+
+                // Keccak and Poseidon hash several messages at once with hash_batch.
+                template<typename Hash>
+                struct is_batch_hashable : std::integral_constant<bool, hashes::is_keccak_1600<Hash>::value ||
+                                                                            hashes::is_poseidon<Hash>::value> { };
+
+                // Whether hash_batch takes messages made of Word for Hash.
+                template<typename Hash, typename Word>
+                struct is_batch_hashable_word
+                    : std::integral_constant<
+                          bool, hashes::is_poseidon<Hash>::value
+                                    ? std::is_same<Word, typename hash_batch_word<Hash>::type>::value
+                                    : hashes::is_keccak_1600<Hash>::value && std::is_integral<Word>::value &&
+                                          sizeof(Word) == 1> { };
+
+                // Leaves which are contiguous words, hashed several at once with hash_batch.
+                template<typename Hash, typename Leaf, typename = void>
+                struct is_batch_hashable_leaf : std::false_type { };
+
+                template<typename Hash, typename Leaf>
+                struct is_batch_hashable_leaf<Hash, Leaf, std::void_t<decltype(std::declval<const Leaf &>().data()),
+                                                                      decltype(std::declval<const Leaf &>().size())>>
+                    : is_batch_hashable_word<Hash, typename std::remove_cv<typename std::remove_pointer<
+                                                       decltype(std::declval<const Leaf &>().data())>::type>::type> { };
+
+                // Number of messages given to hash_batch at once, enough for the widest SIMD path and for the
+                // lanes of the Poseidon multi-state permutation.
+                constexpr static const std::size_t HASH_BATCH_SIZE = 8;
+
+                /**
+                 * Writes the digests of the leaves [first, last) to 'out', which must point into contiguous memory.
+                 * Runs of leaves of the same size are hashed together if is_batch_hashable_leaf holds.
+                 */
+                template<typename Hash, typename LeafIterator>
+                void compute_leaf_hashes(LeafIterator first, LeafIterator last, typename Hash::digest_type *out) {
+                    typedef typename std::iterator_traits<LeafIterator>::value_type leaf_value_type;
+
+                    if constexpr (is_batch_hashable_leaf<Hash, leaf_value_type>::value) {
+                        typedef typename hash_batch_word<Hash>::type word_type;
+                        const word_type *messages[HASH_BATCH_SIZE];
+                        while (first != last) {
+                            const std::size_t length = first->size();
+                            std::size_t count = 0;
+                            while (count < HASH_BATCH_SIZE && first != last && first->size() == length) {
+                                messages[count++] = reinterpret_cast<const word_type *>(first->data());
+                                ++first;
+                            }
+                            hash_batch<Hash>(messages, length, count, out);
+                            out += count;
+                        }
+                    } else {
+                        for (; first != last; ++first, ++out) {
+                            *out = static_cast<typename Hash::digest_type>(crypto3::hash<Hash>(*first));
+                        }
+                    }
+                }
+
+                // Fills the rows above the leaves, the leaves must be already in the tree.
+                template<typename T, std::size_t Arity>
+                void hash_inner_rows(merkle_tree_impl<T, Arity> &tree) {
+                    typedef typename T::hash_type hash_type;
+                    typedef typename T::value_type value_type;
+
+                    std::size_t row_idx = tree.leaves(), row_size = row_idx / Arity;
+                    typename merkle_tree_impl<T, Arity>::iterator it = tree.begin();
+
+                    std::size_t next_row_start_index = tree.leaves();
+
+                    for (size_t row_number = 1; row_number < tree.row_count(); ++row_number, row_size /= Arity) {
+                        if constexpr (is_batch_hashable<hash_type>::value &&
+                                      std::is_same<value_type, typename hash_type::digest_type>::value) {
+                            // The children of a node are adjacent digests, so each node hashes Arity digests of
+                            // the previous row in place: Arity field elements for Poseidon, their bytes for Keccak.
+                            typedef typename hash_batch_word<hash_type>::type word_type;
+                            constexpr std::size_t length =
+                                hashes::is_poseidon<hash_type>::value ? Arity : Arity * sizeof(value_type);
+                            nil::crypto3::parallel_for_chunks(
+                                row_size, [&tree, it, next_row_start_index](std::size_t begin, std::size_t end) {
+                                    const word_type *messages[HASH_BATCH_SIZE];
+                                    for (std::size_t index = begin; index < end; index += HASH_BATCH_SIZE) {
+                                        const std::size_t count = std::min(HASH_BATCH_SIZE, end - index);
+                                        for (std::size_t i = 0; i < count; ++i) {
+                                            messages[i] = reinterpret_cast<const word_type *>(
+                                                &*(it + (index + i) * Arity));
+                                        }
+                                        hash_batch<hash_type>(messages, length, count,
+                                                              &tree[next_row_start_index + index]);
+                                    }
+                                });
+                        } else {
+                            nil::crypto3::parallel_for(0, row_size, [&tree, it, next_row_start_index](std::size_t index) {
+                                tree[next_row_start_index + index] = generate_hash<hash_type>(
+                                    it + index * Arity, it + (index + 1) * Arity);
+                            });
+                        }
+                        next_row_start_index += row_size;
+                        it += row_size * Arity;
+                    }
+                }
+
                 template<typename T, std::size_t Arity, typename LeafIterator>
                 merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
                     typedef T node_type;
@@ -492,23 +606,32 @@ namespace nil {
                     merkle_tree_impl<T, Arity> ret(std::distance(first, last));
                     ret.resize(ret.complete_size());
 
-                    nil::crypto3::parallel_transform(first, last, ret.begin(), [](const leaf_value_type& leaf) {
-                        return static_cast<value_type>(crypto3::hash<hash_type>(leaf));
-                    });
+                    if constexpr (is_batch_hashable_leaf<hash_type, leaf_value_type>::value &&
+                                  std::is_same<value_type, typename hash_type::digest_type>::value) {
+                        nil::crypto3::parallel_for_chunks(ret.leaves(), [first, &ret](std::size_t begin, std::size_t end) {
+                            compute_leaf_hashes<hash_type>(first + begin, first + end, &ret[begin]);
+                        });
+                    } else {
+                        nil::crypto3::parallel_transform(first, last, ret.begin(), [](const leaf_value_type& leaf) {
+                            return static_cast<value_type>(crypto3::hash<hash_type>(leaf));
+                        });
+                    }
 
-                    std::size_t row_idx = ret.leaves(), row_size = row_idx / Arity;
-                    typename merkle_tree_impl<T, Arity>::iterator it = ret.begin();
+                    hash_inner_rows(ret);
+                    return ret;
+                }
 
-                    std::size_t next_row_start_index = std::distance(first, last);
+                template<typename T, std::size_t Arity, typename LeafHasher>
+                merkle_tree_impl<T, Arity> make_merkle_tree(std::size_t leaves_number, const LeafHasher &hash_leaves) {
+                    merkle_tree_impl<T, Arity> ret(leaves_number);
+                    ret.resize(ret.complete_size());
 
-                    for (size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
-                        nil::crypto3::parallel_for(0, row_size, [&ret, it, next_row_start_index](std::size_t index) {
-                            ret[next_row_start_index + index] = generate_hash<hash_type>(
-                                it + index * Arity, it + (index + 1) * Arity);
-                        });
-                        next_row_start_index += row_size;
-                        it += row_size * Arity;
-                    }
+                    auto leaves = ret.begin();
+                    nil::crypto3::parallel_for_chunks(leaves_number, [&hash_leaves, leaves](std::size_t begin, std::size_t end) {
+                        hash_leaves(begin, end, leaves + begin);
+                    });
+
+                    hash_inner_rows(ret);
                     return ret;
                 }
             }    // namespace detail
@@ -526,6 +649,19 @@ namespace nil {
                         Arity>(first, last);
             }
 
+            /**
+             * Builds the tree without keeping all the leaves in memory: hash_leaves(begin, end, out) must write
+             * the digests of the leaves [begin, end) to the iterator 'out'. It is called on disjoint ranges,
+             * possibly in parallel, so the caller only needs scratch space for the leaves of one range.
+             */
+            template<typename T, std::size_t Arity, typename LeafHasher>
+            merkle_tree<T, Arity> make_merkle_tree(std::size_t leaves_number, const LeafHasher &hash_leaves) {
+                return detail::make_merkle_tree<typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                        detail::merkle_tree_node<T>,
+                        T>::type,
+                        Arity>(leaves_number, hash_leaves);
+            }
+
         }    // namespace containers
     }        // namespace crypto3
 }    // namespace nil
@@ -0,0 +1,97 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_BATCH_INVERSION_HPP
+#define CRYPTO3_MATH_BATCH_INVERSION_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            namespace detail {
+                template<typename RandomAccessIterator>
+                void serial_batch_inversion(RandomAccessIterator first, RandomAccessIterator last) {
+                    typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+                    const std::size_t n = std::distance(first, last);
+                    if (n == 0) {
+                        return;
+                    }
+
+                    // prefix[i] is the product of all the non-zero elements before i.
+                    std::vector<value_type> prefix(n);
+                    value_type acc = value_type::one();
+                    for (std::size_t i = 0; i < n; ++i) {
+                        prefix[i] = acc;
+                        if (!first[i].is_zero()) {
+                            acc *= first[i];
+                        }
+                    }
+
+                    // acc holds the inverse of the product of the elements up to i, inclusive.
+                    acc = acc.inversed();
+                    for (std::size_t i = n; i-- > 0;) {
+                        if (first[i].is_zero()) {
+                            continue;
+                        }
+                        value_type inverse = acc * prefix[i];
+                        acc *= first[i];
+                        first[i] = inverse;
+                    }
+                }
+            }    // namespace detail
+
+            /**
+             * Replaces every element of [first, last) with its inverse (Montgomery's trick).
+             *
+             * The range is split into chunks which are processed in parallel, each chunk costs one field inversion
+             * and 3 multiplications per element. Zeros have no inverse and are left unchanged.
+             */
+            template<typename RandomAccessIterator>
+            void batch_inversion(RandomAccessIterator first, RandomAccessIterator last,
+                                 ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+                parallel_for_chunks(
+                    std::distance(first, last),
+                    [first](std::size_t begin, std::size_t end) {
+                        detail::serial_batch_inversion(first + begin, first + end);
+                    },
+                    pool_id);
+            }
+
+            template<typename Range>
+            void batch_inversion(Range &values, ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+                batch_inversion(std::begin(values), std::end(values), pool_id);
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_BATCH_INVERSION_HPP
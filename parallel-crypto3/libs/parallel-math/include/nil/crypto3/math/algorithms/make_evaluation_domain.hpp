@@ -29,6 +29,7 @@
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/arithmetic_sequence_domain.hpp>
 #include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
+#include <nil/crypto3/math/domains/evaluation_domain_registry.hpp>
 #include <nil/crypto3/math/domains/extended_radix2_domain.hpp>
 #include <nil/crypto3/math/domains/geometric_sequence_domain.hpp>
 #include <nil/crypto3/math/domains/step_radix2_domain.hpp>
@@ -110,10 +111,9 @@ namespace nil {
                 const std::size_t big = 1ul << (std::size_t(std::ceil(std::log2(m))) - 1);
                 const std::size_t rounded_small = (1ul << std::size_t(std::ceil(std::log2(m - big))));
 
+                // Basic radix-2 domains are shared between all the callers, see evaluation_domain_registry.
                 if (detail::is_basic_radix2_domain<FieldType>(m)) {
-                    result_type result;
-                    result.reset(new basic_radix2_domain<FieldType, ValueType>(m));
-                    return result;
+                    return evaluation_domain_registry<FieldType, ValueType>::get_instance().get(m);
                 }
 
                 if (detail::is_extended_radix2_domain<FieldType>(m)) {
@@ -129,9 +129,7 @@ namespace nil {
                 }
 
                 if (detail::is_basic_radix2_domain<FieldType>(big + rounded_small)) {
-                    result_type result;
-                    result.reset(new basic_radix2_domain<FieldType, ValueType>(big + rounded_small));
-                    return result;
+                    return evaluation_domain_registry<FieldType, ValueType>::get_instance().get(big + rounded_small);
                 }
 
                 if (detail::is_extended_radix2_domain<FieldType>(big + rounded_small)) {
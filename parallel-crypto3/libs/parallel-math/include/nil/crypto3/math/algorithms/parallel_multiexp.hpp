@@ -0,0 +1,485 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MATH_PARALLEL_MULTIEXP_HPP
+#define CRYPTO3_MATH_PARALLEL_MULTIEXP_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+
+#include <nil/crypto3/math/algorithms/batch_inversion.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace policies {
+                namespace detail {
+
+                    // Short Weierstrass points whose affine form is (X / Z^2, Y / Z^3).
+                    template<typename Coordinates>
+                    struct is_jacobian_coordinates
+                        : std::integral_constant<
+                              bool,
+                              std::is_same<Coordinates, curves::coordinates::jacobian>::value ||
+                                  std::is_same<Coordinates, curves::coordinates::jacobian_with_a4_0>::value ||
+                                  std::is_same<Coordinates, curves::coordinates::jacobian_with_a4_minus_3>::value> { };
+
+                    // Short Weierstrass points whose affine form is (X / Z, Y / Z).
+                    template<typename Coordinates>
+                    struct is_projective_coordinates
+                        : std::integral_constant<
+                              bool,
+                              std::is_same<Coordinates, curves::coordinates::projective>::value ||
+                                  std::is_same<Coordinates, curves::coordinates::projective_with_a4_minus_3>::value> {
+                    };
+
+                    // Points which the buckets can add up in affine coordinates with the chord rule.
+                    template<typename GroupValueType>
+                    struct is_batch_affine_addable
+                        : std::integral_constant<
+                              bool,
+                              std::is_same<typename GroupValueType::form, curves::forms::short_weierstrass>::value &&
+                                  (is_jacobian_coordinates<typename GroupValueType::coordinates>::value ||
+                                   is_projective_coordinates<typename GroupValueType::coordinates>::value)> { };
+
+                    template<typename FieldValueType>
+                    struct affine_point {
+                        FieldValueType X;
+                        FieldValueType Y;
+                    };
+
+                    // Returns the 'c' bits of the integer 'value' starting from bit 'position'.
+                    template<typename Backend>
+                    std::int64_t scalar_window(const Backend &value, std::size_t position, std::size_t c) {
+                        const auto *limbs = value.limbs();
+                        constexpr std::size_t limb_bits = sizeof(*limbs) * CHAR_BIT;
+
+                        std::size_t limb = position / limb_bits;
+                        std::size_t shift = position % limb_bits;
+                        std::uint64_t window = 0;
+                        for (std::size_t bits = 0; bits < c && limb < value.size();
+                             bits += limb_bits - shift, shift = 0, ++limb) {
+                            window |= (static_cast<std::uint64_t>(limbs[limb]) >> shift) << bits;
+                        }
+                        return static_cast<std::int64_t>(window & ((std::uint64_t(1) << c) - 1));
+                    }
+
+                    // Writes the signed c-bit digits of 'value' to digits[w * stride] for w < windows, so that
+                    // value = sum(digits[w * stride] * 2^(w * c)) and every digit is in (-2^(c-1), 2^(c-1)].
+                    template<typename IntegralType>
+                    void signed_digits(const IntegralType &value, std::size_t c, std::size_t windows,
+                                       std::int32_t *digits, std::size_t stride) {
+                        const std::int64_t half = std::int64_t(1) << (c - 1);
+                        std::int64_t carry = 0;
+                        for (std::size_t w = 0; w < windows; ++w) {
+                            std::int64_t digit = scalar_window(value.backend(), w * c, c) + carry;
+                            carry = digit > half ? 1 : 0;
+                            digits[w * stride] = static_cast<std::int32_t>(digit - (carry << c));
+                        }
+                        BOOST_ASSERT(carry == 0);
+                    }
+
+                    /**
+                     * Adds up the points of every bucket. Bucket b takes size[b] points of 'points' starting
+                     * from begin[b]. The points of each bucket are added in pairs, and all the pairs of all the
+                     * buckets share one inversion for the slopes, which is repeated until at most one point is
+                     * left in every bucket, at begin[b]. A sum which is the point at infinity is dropped.
+                     */
+                    template<typename GroupValueType, typename FieldValueType>
+                    void reduce_buckets(std::vector<affine_point<FieldValueType>> &points,
+                                        const std::vector<std::size_t> &begin, std::vector<std::size_t> &size,
+                                        std::vector<FieldValueType> &denominators) {
+                        const std::size_t buckets = size.size();
+                        for (;;) {
+                            denominators.clear();
+                            for (std::size_t b = 0; b < buckets; ++b) {
+                                for (std::size_t j = begin[b]; j + 1 < begin[b] + size[b]; j += 2) {
+                                    denominators.push_back(points[j + 1].X - points[j].X);
+                                }
+                            }
+                            if (denominators.empty()) {
+                                break;
+                            }
+                            // Equal X leaves a zero, which is not inverted and is handled separately below.
+                            math::detail::serial_batch_inversion(denominators.begin(), denominators.end());
+
+                            std::size_t k = 0;
+                            for (std::size_t b = 0; b < buckets; ++b) {
+                                // The sum of the points at j and j + 1 goes to out <= j, which is already read.
+                                std::size_t out = begin[b];
+                                const std::size_t last = begin[b] + size[b];
+                                for (std::size_t j = begin[b]; j + 1 < last; j += 2) {
+                                    const affine_point<FieldValueType> &p = points[j], &q = points[j + 1];
+                                    const FieldValueType &inversed = denominators[k++];
+                                    if (p.X == q.X) {
+                                        // Either P + P, or P + (-P), which is the point at infinity.
+                                        if (p.Y == q.Y && !p.Y.is_zero()) {
+                                            GroupValueType doubled(p.X, p.Y);
+                                            doubled.double_inplace();
+                                            auto affine = doubled.to_affine();
+                                            points[out++] = {affine.X, affine.Y};
+                                        }
+                                        continue;
+                                    }
+                                    FieldValueType lambda = (q.Y - p.Y) * inversed;
+                                    FieldValueType X = lambda.squared() - p.X - q.X;
+                                    FieldValueType Y = lambda * (p.X - X) - p.Y;
+                                    points[out].X = X;
+                                    points[out].Y = Y;
+                                    ++out;
+                                }
+                                if (size[b] % 2 == 1) {
+                                    points[out++] = points[last - 1];
+                                }
+                                size[b] = out - begin[b];
+                            }
+                        }
+                    }
+
+                    /**
+                     * Sets buckets[m - lo] to the sum of the points whose digit in 'digits' has the absolute value
+                     * m, lo <= m < hi, negated for negative digits. The digits are taken in blocks, the points of a
+                     * block are sorted by bucket together with the sums of the previous blocks, and added up with
+                     * reduce_buckets, so the memory does not grow with the number of points.
+                     */
+                    template<typename GroupValueType, typename FieldValueType>
+                    void affine_bucket_sums(const std::vector<affine_point<FieldValueType>> &points,
+                                            const std::int32_t *digits, std::size_t lo, std::size_t hi,
+                                            std::vector<GroupValueType> &buckets) {
+                        const std::size_t n = points.size();
+                        const std::size_t range = hi - lo;
+                        const std::size_t block_size = std::max<std::size_t>(8192, 4 * range);
+
+                        std::vector<affine_point<FieldValueType>> sums(range);
+                        std::vector<bool> has_sum(range, false);
+
+                        std::vector<affine_point<FieldValueType>> block_points;
+                        std::vector<std::size_t> begin(range), size(range), cursor(range);
+                        std::vector<FieldValueType> denominators;
+
+                        for (std::size_t block_begin = 0; block_begin < n; block_begin += block_size) {
+                            const std::size_t block_end = std::min(n, block_begin + block_size);
+
+                            for (std::size_t b = 0; b < range; ++b) {
+                                size[b] = has_sum[b] ? 1 : 0;
+                            }
+                            for (std::size_t i = block_begin; i < block_end; ++i) {
+                                const std::size_t m = std::abs(digits[i]);
+                                if (m >= lo && m < hi) {
+                                    ++size[m - lo];
+                                }
+                            }
+                            std::size_t total = 0;
+                            for (std::size_t b = 0; b < range; ++b) {
+                                begin[b] = cursor[b] = total;
+                                total += size[b];
+                            }
+
+                            block_points.resize(total);
+                            for (std::size_t b = 0; b < range; ++b) {
+                                if (has_sum[b]) {
+                                    block_points[cursor[b]++] = sums[b];
+                                }
+                            }
+                            for (std::size_t i = block_begin; i < block_end; ++i) {
+                                const std::size_t m = std::abs(digits[i]);
+                                if (m >= lo && m < hi) {
+                                    affine_point<FieldValueType> &point = block_points[cursor[m - lo]++];
+                                    point.X = points[i].X;
+                                    point.Y = digits[i] > 0 ? points[i].Y : -points[i].Y;
+                                }
+                            }
+
+                            reduce_buckets<GroupValueType>(block_points, begin, size, denominators);
+
+                            for (std::size_t b = 0; b < range; ++b) {
+                                has_sum[b] = size[b] != 0;
+                                if (has_sum[b]) {
+                                    sums[b] = block_points[begin[b]];
+                                }
+                            }
+                        }
+
+                        for (std::size_t b = 0; b < range; ++b) {
+                            buckets[b] = has_sum[b] ? GroupValueType(sums[b].X, sums[b].Y) : GroupValueType::zero();
+                        }
+                    }
+
+                    template<typename InputBaseIterator, typename GroupValueType>
+                    void projective_bucket_sums(InputBaseIterator bases, std::size_t n, const std::int32_t *digits,
+                                                std::size_t lo, std::size_t hi,
+                                                std::vector<GroupValueType> &buckets) {
+                        std::fill(buckets.begin(), buckets.end(), GroupValueType::zero());
+                        for (std::size_t i = 0; i < n; ++i) {
+                            const std::size_t m = std::abs(digits[i]);
+                            if (m >= lo && m < hi) {
+                                if (digits[i] > 0) {
+                                    buckets[m - lo] += bases[i];
+                                } else {
+                                    buckets[m - lo] -= bases[i];
+                                }
+                            }
+                        }
+                    }
+
+                    // Returns k * point for a small k.
+                    template<typename GroupValueType>
+                    GroupValueType small_multiple(GroupValueType point, std::size_t k) {
+                        GroupValueType result = GroupValueType::zero();
+                        while (k != 0 && !point.is_zero()) {
+                            if (k & 1) {
+                                result += point;
+                            }
+                            k >>= 1;
+                            if (k != 0) {
+                                point.double_inplace();
+                            }
+                        }
+                        return result;
+                    }
+
+                    // Returns sum(m * buckets[m - lo]) over lo <= m < lo + buckets.size().
+                    template<typename GroupValueType>
+                    GroupValueType weighted_bucket_sum(const std::vector<GroupValueType> &buckets, std::size_t lo) {
+                        // The running sum gives sum((m - lo + 1) * buckets[m - lo]), the rest is (lo - 1) times
+                        // the sum of all the buckets, which is the final running sum.
+                        GroupValueType running = GroupValueType::zero();
+                        GroupValueType result = GroupValueType::zero();
+                        for (std::size_t b = buckets.size(); b-- > 0;) {
+                            running += buckets[b];
+                            result += running;
+                        }
+                        result += small_multiple(running, lo - 1);
+                        return result;
+                    }
+                }    // namespace detail
+
+                /**
+                 * Pippenger's bucket method with signed digits, which runs on the thread pool.
+                 *
+                 * Every scalar is split once into signed c-bit digits in (-2^(c-1), 2^(c-1)], so a window needs
+                 * 2^(c-1) buckets and a negative digit adds the negated point to the bucket of its absolute value.
+                 * The work is split into tasks by windows and by ranges of buckets within a window, each task
+                 * returns the weighted sum of its buckets, and the windows are combined by doubling at the end.
+                 *
+                 * For short Weierstrass curves the points are converted to affine coordinates with one shared
+                 * inversion, and the buckets are added up in affine coordinates, where all the additions of one
+                 * round share a single inversion (see detail::reduce_buckets). This is about twice cheaper than
+                 * the mixed additions in projective coordinates. Other curves add up the buckets in their own
+                 * coordinates.
+                 *
+                 * On the curves with the GLV endomorphism every term k * P is split into k1 * P + k2 * Q, where
+                 * Q = (glv_beta * x, y) is taken right from the affine point, and k1, k2 have half the bits of k.
+                 * Twice as many points go through half as many windows (see curves/detail/glv.hpp).
+                 */
+                struct multiexp_method_parallel_pippenger {
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator bases,
+                                InputBaseIterator bases_end,
+                                InputFieldIterator exponents,
+                                InputFieldIterator exponents_end) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                        typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
+                        typedef typename field_value_type::integral_type integral_type;
+                        typedef typename base_value_type::field_type::value_type coordinate_type;
+
+                        constexpr bool batch_affine = detail::is_batch_affine_addable<base_value_type>::value;
+                        constexpr bool glv =
+                            batch_affine && curves::detail::has_glv_endomorphism<base_value_type>::value;
+
+                        const std::size_t length = std::distance(bases, bases_end);
+                        BOOST_ASSERT(length == std::size_t(std::distance(exponents, exponents_end)));
+                        if (length == 0) {
+                            return base_value_type::zero();
+                        }
+
+                        // The term i of the sum is magnitudes[i] times points[i] negated when negative[i] is set.
+                        // With GLV, the term length + i is the second half of exponents[i] and its point is
+                        // glv_endomorphism(bases[i]).
+                        const std::size_t terms = glv ? 2 * length : length;
+                        std::vector<integral_type> magnitudes(terms);
+                        std::vector<std::uint8_t> negative;
+                        if constexpr (glv) {
+                            negative.resize(terms);
+                        }
+                        std::vector<coordinate_type> z_inversed;
+                        if constexpr (batch_affine) {
+                            z_inversed.resize(length);
+                        }
+
+                        // Zero bases are left with zero magnitudes.
+                        parallel_for_chunks(
+                            length,
+                            [&](std::size_t begin, std::size_t end) {
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    if (!bases[i].is_zero()) {
+                                        if constexpr (glv) {
+                                            auto decomposition = curves::detail::glv_decompose<
+                                                typename base_value_type::params_type>(exponents[i]);
+                                            magnitudes[i] = decomposition.k1;
+                                            magnitudes[length + i] = decomposition.k2;
+                                            negative[i] = decomposition.k1_negative;
+                                            negative[length + i] = decomposition.k2_negative;
+                                        } else {
+                                            magnitudes[i] = static_cast<integral_type>(exponents[i].data);
+                                        }
+                                    }
+                                    if constexpr (batch_affine) {
+                                        z_inversed[i] = bases[i].Z;
+                                    }
+                                }
+                            },
+                            ThreadPool::PoolLevel::LOW);
+
+                        // boost::multiprecision::msb doesn't work for zero value.
+                        std::size_t num_bits = 1;
+                        for (std::size_t i = 0; i < terms; ++i) {
+                            if (!magnitudes[i].is_zero()) {
+                                num_bits =
+                                    std::max<std::size_t>(num_bits, boost::multiprecision::msb(magnitudes[i]) + 1);
+                            }
+                        }
+
+                        // The estimate of multiexp_method_BDLO12, the signed digits halve the number of buckets.
+                        const std::size_t log2_length = std::log2(terms);
+                        const std::size_t c = std::min<std::size_t>(log2_length - log2_length / 3 + 2, 16);
+                        const std::size_t half = std::size_t(1) << (c - 1);
+                        // One more window than the bits need takes the carry of the top digit.
+                        const std::size_t windows = num_bits / c + 1;
+
+                        // digits[w * terms + i] is the digit of window w of the term i.
+                        std::vector<std::int32_t> digits(windows * terms);
+                        parallel_for_chunks(
+                            terms,
+                            [&](std::size_t begin, std::size_t end) {
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    detail::signed_digits(magnitudes[i], c, windows, digits.data() + i, terms);
+                                }
+                            },
+                            ThreadPool::PoolLevel::LOW);
+                        magnitudes.clear();
+                        magnitudes.shrink_to_fit();
+
+                        std::vector<detail::affine_point<coordinate_type>> points;
+                        if constexpr (batch_affine) {
+                            points.resize(terms);
+                            math::batch_inversion(z_inversed);
+                            parallel_for_chunks(
+                                length,
+                                [&](std::size_t begin, std::size_t end) {
+                                    for (std::size_t i = begin; i < end; ++i) {
+                                        const coordinate_type &zi = z_inversed[i];
+                                        if constexpr (detail::is_jacobian_coordinates<
+                                                          typename base_value_type::coordinates>::value) {
+                                            const coordinate_type zi2 = zi.squared();
+                                            points[i].X = bases[i].X * zi2;
+                                            points[i].Y = bases[i].Y * zi2 * zi;
+                                        } else {
+                                            points[i].X = bases[i].X * zi;
+                                            points[i].Y = bases[i].Y * zi;
+                                        }
+                                        if constexpr (glv) {
+                                            const std::size_t j = length + i;
+                                            points[j].X = points[i].X * base_value_type::params_type::glv_beta;
+                                            points[j].Y = negative[j] ? -points[i].Y : points[i].Y;
+                                            if (negative[i]) {
+                                                points[i].Y = -points[i].Y;
+                                            }
+                                        }
+                                    }
+                                },
+                                ThreadPool::PoolLevel::LOW);
+                            z_inversed.clear();
+                            z_inversed.shrink_to_fit();
+                        }
+
+                        // Enough tasks to keep every thread busy, the buckets of a window are split evenly.
+                        const std::size_t threads =
+                            ThreadPool::get_instance(ThreadPool::PoolLevel::LOW).get_pool_size();
+                        const std::size_t parts =
+                            std::min(half, std::max<std::size_t>(1, (2 * threads + windows - 1) / windows));
+                        const std::size_t tasks = windows * parts;
+
+                        std::vector<base_value_type> task_sums(tasks);
+                        parallel_for_chunks(
+                            tasks,
+                            [&](std::size_t begin, std::size_t end) {
+                                std::vector<base_value_type> buckets;
+                                for (std::size_t t = begin; t < end; ++t) {
+                                    const std::size_t w = t / parts, part = t % parts;
+                                    const std::size_t lo = 1 + part * half / parts;
+                                    const std::size_t hi = 1 + (part + 1) * half / parts;
+                                    const std::int32_t *window_digits = digits.data() + w * terms;
+
+                                    buckets.resize(hi - lo);
+                                    if constexpr (batch_affine) {
+                                        detail::affine_bucket_sums(points, window_digits, lo, hi, buckets);
+                                    } else {
+                                        detail::projective_bucket_sums(bases, length, window_digits, lo, hi,
+                                                                       buckets);
+                                    }
+                                    task_sums[t] = detail::weighted_bucket_sum(buckets, lo);
+                                }
+                            },
+                            ThreadPool::PoolLevel::LOW);
+
+                        base_value_type result = base_value_type::zero();
+                        for (std::size_t w = windows; w-- > 0;) {
+                            if (!result.is_zero()) {
+                                for (std::size_t i = 0; i < c; ++i) {
+                                    result.double_inplace();
+                                }
+                            }
+                            for (std::size_t part = 0; part < parts; ++part) {
+                                result += task_sums[w * parts + part];
+                            }
+                        }
+                        return result;
+                    }
+                };
+            }    // namespace policies
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_PARALLEL_MULTIEXP_HPP
@@ -49,24 +49,16 @@ namespace nil {
             class basic_radix2_domain : public evaluation_domain<FieldType, ValueType> {
                 typedef typename FieldType::value_type field_value_type;
                 typedef ValueType value_type;
-                typedef std::pair<std::vector<field_value_type>, std::vector<field_value_type>> cache_type;
-                std::shared_ptr<cache_type> fft_cache;
-
-                void create_fft_cache() {
-                    fft_cache = std::make_shared<cache_type>(std::vector<field_value_type>(),
-                                                             std::vector<field_value_type>());
-                    detail::create_fft_cache<FieldType>(this->m, omega, fft_cache->first);
-                    detail::create_fft_cache<FieldType>(this->m, omega.inversed(), fft_cache->second);
-                }
 
             public:
                 typedef FieldType field_type;
+                // Direct and inverse powers of the root of unity of some size N >= m.
+                typedef std::pair<std::vector<field_value_type>, std::vector<field_value_type>> cache_type;
 
-                field_value_type omega;
+            private:
+                std::shared_ptr<const cache_type> fft_cache;
 
-                basic_radix2_domain(const std::size_t m)
-                        : evaluation_domain<FieldType, ValueType>(m),
-                          omega(unity_root<FieldType>(m)) {
+                void check_size(const std::size_t m) const {
                     if (m <= 1)
                         throw std::invalid_argument("basic_radix2(): expected m > 1");
 
@@ -76,9 +68,42 @@ namespace nil {
                             throw std::invalid_argument(
                                     "basic_radix2(): expected logm <= fields::arithmetic_params<FieldType>::s");
                     }
+                }
+
+            public:
+                field_value_type omega;
+
+                /**
+                 * Builds the fft cache for the domain of size m. The cache can be shared with all the domains
+                 * of size m or smaller, see evaluation_domain_registry.
+                 */
+                static std::shared_ptr<const cache_type> make_fft_cache(const std::size_t m) {
+                    auto cache = std::make_shared<cache_type>();
+                    detail::create_fft_cache<FieldType>(m, unity_root<FieldType>(m), cache->first);
+                    detail::create_inverse_fft_cache<FieldType>(cache->first, cache->second);
+                    return cache;
+                }
+
+                basic_radix2_domain(const std::size_t m)
+                        : evaluation_domain<FieldType, ValueType>(m),
+                          omega(unity_root<FieldType>(m)) {
+                    check_size(m);
 
                     // We need to always create fft cache, we cannot create it when needed in parallel environment.
-                    create_fft_cache();
+                    fft_cache = make_fft_cache(m);
+                }
+
+                /**
+                 * Creates the domain reusing an fft cache built for the size N >= m, every N/m-th element of it is used.
+                 */
+                basic_radix2_domain(const std::size_t m, std::shared_ptr<const cache_type> shared_fft_cache)
+                        : evaluation_domain<FieldType, ValueType>(m),
+                          fft_cache(std::move(shared_fft_cache)),
+                          omega(unity_root<FieldType>(m)) {
+                    check_size(m);
+
+                    if (!fft_cache || fft_cache->first.size() < m || fft_cache->first.size() % m != 0)
+                        throw std::invalid_argument("basic_radix2(): expected fft cache of size N >= m, N % m == 0");
                 }
 
                 void fft(std::vector<value_type> &a) override {
@@ -90,7 +115,7 @@ namespace nil {
                         }
                     }
 
-                    detail::basic_radix2_fft_cached<FieldType>(a, fft_cache->first);
+                    detail::basic_radix2_fft_select<FieldType>(a, fft_cache->first);
                 }
 
                 void inverse_fft(std::vector<value_type> &a) override {
@@ -102,7 +127,7 @@ namespace nil {
                         }
                     }
 
-                    detail::basic_radix2_fft_cached<FieldType>(a, fft_cache->second);
+                    detail::basic_radix2_fft_select<FieldType>(a, fft_cache->second);
 
                     const field_value_type sconst = field_value_type(a.size()).inversed();
                     nil::crypto3::parallel_foreach(a.begin(), a.end(), [&sconst](value_type& a_i){
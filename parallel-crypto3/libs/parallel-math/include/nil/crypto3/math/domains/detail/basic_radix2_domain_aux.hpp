@@ -33,6 +33,7 @@
 
 #include <nil/crypto3/algebra/type_traits.hpp>
 
+#include <nil/crypto3/math/algorithms/batch_inversion.hpp>
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
 
@@ -44,6 +45,10 @@ namespace nil {
         namespace math {
             namespace detail {
 
+                // FFTs of this size and larger are done with basic_radix2_fft_blocked. For smaller sizes the
+                // sub-transforms are too small, and the stage-parallel basic_radix2_fft_cached is not slower.
+                static constexpr std::size_t BLOCKED_FFT_MIN_SIZE = 1 << 16;
+
                 /*
                  * Building caches for fft operations
                 */
@@ -54,18 +59,40 @@ namespace nil {
                         std::vector<typename FieldType::value_type> &cache) {
                     typedef typename FieldType::value_type value_type;
                     cache.resize(size, FieldType::value_type::zero());
-                    wait_for_all(parallel_run_in_chunks<void>(
+                    parallel_for_chunks(
                         size,
                         [&cache, &omega](std::size_t begin, std::size_t end) {
+                            if (begin == end)
+                                return;
                             cache[begin] = omega.pow(begin);
                             for (std::size_t i = begin + 1; i < end; ++i) {
                                 cache[i] = cache[i - 1] * omega;
                             }
-                        }, ThreadPool::PoolLevel::LOW));
+                        }, ThreadPool::PoolLevel::LOW);
+                }
+
+                /*
+                 * Builds the cache of inverse powers from the cache of direct powers of the same root of unity,
+                 * omega^(-i) = omega^(N - i), so no field multiplications are needed.
+                 */
+                template<typename FieldType>
+                void create_inverse_fft_cache(
+                        const std::vector<typename FieldType::value_type> &cache,
+                        std::vector<typename FieldType::value_type> &inverse_cache) {
+                    const std::size_t size = cache.size();
+                    inverse_cache.resize(size, FieldType::value_type::zero());
+                    if (size == 0)
+                        return;
+                    inverse_cache[0] = cache[0];
+                    nil::crypto3::parallel_for(1, size,
+                        [&cache, &inverse_cache, size](std::size_t i) {
+                            inverse_cache[i] = cache[size - i];
+                        });
                 }
 
                 /*
                  * Below we make use of pseudocode from [CLRS 2n Ed, pp. 864].
+                 * 'omega_cache' may be built for any power of two size N >= n, then every N / n-th power is used.
                  * Also, note that it's the caller's responsibility to multiply by 1/N.
                  */
                 template<typename FieldType, typename Range>
@@ -80,6 +107,8 @@ namespace nil {
                     const std::size_t n = a.size(), logn = log2(n);
                     if (n != (1u << logn))
                         throw std::invalid_argument("expected n == (1u << logn)");
+                    if (omega_cache.size() < n)
+                        throw std::invalid_argument("expected omega_cache.size() >= n");
 
                     // swapping in place (from Storer's book)
                     // We can parallelize this look, since k and rk are pairs, they will never intersect.
@@ -94,13 +123,13 @@ namespace nil {
 
                     // invariant: m = 2^{s-1}
                     value_type t;
-                    for (std::size_t s = 1, m = 1, inc = n / 2; s <= logn; ++s, m <<= 1, inc >>= 1) {
+                    for (std::size_t s = 1, m = 1, inc = omega_cache.size() / 2; s <= logn; ++s, m <<= 1, inc >>= 1) {
                         // w_m is 2^s-th root of unity now
                         size_t count_k = n / (2 * m) + (n % (2 * m) ? 1 : 0);
 
                         // Here we can parallelize on the both loops with 'k' and 'm', because for each value of k and m
                         // the ranges of array 'a' used do not intersect. Think of these 2 loops as 1.
-                        wait_for_all(parallel_run_in_chunks<void>(
+                        parallel_for_chunks(
                             m * count_k,
                             [&a, m, count_k, inc, &omega_cache](std::size_t begin, std::size_t end) {
                                 size_t current_index = begin;
@@ -125,7 +154,123 @@ namespace nil {
                                     }
                                 }
                             }, ThreadPool::PoolLevel::LOW
-                        ));
+                        );
+                    }
+                }
+
+                /*
+                 * Serial in-place radix-2 FFT of a contiguous block of size 2^logl. 'omega_cache' holds powers of
+                 * the N-th root of unity for some N >= 2^logl, so the twiddles of the block are taken with stride
+                 * N / 2^logl. Used by the blocked FFT below, the block is expected to fit into the per-core cache.
+                 */
+                template<typename FieldType, typename ValueType>
+                void basic_radix2_fft_block(ValueType *a, const std::size_t logl,
+                                            const std::vector<typename FieldType::value_type> &omega_cache) {
+                    const std::size_t l = std::size_t(1) << logl;
+                    const std::size_t n = omega_cache.size();
+
+                    for (std::size_t k = 0; k < l; ++k) {
+                        const std::size_t rk = crypto3::math::detail::bitreverse(k, logl);
+                        if (k < rk)
+                            std::swap(a[k], a[rk]);
+                    }
+
+                    ValueType t;
+                    for (std::size_t m = 1; m < l; m <<= 1) {
+                        // The stage of size 2m needs the powers of 2m-th root of unity, which is omega^(n / 2m).
+                        const std::size_t inc = n / (2 * m);
+                        for (std::size_t k = 0; k < l; k += 2 * m) {
+                            for (std::size_t j = 0, idx = 0; j < m; ++j, idx += inc) {
+                                t = a[k + j + m];
+                                t *= omega_cache[idx];
+                                a[k + j + m] = a[k + j];
+                                a[k + j + m] -= t;
+                                a[k + j] += t;
+                            }
+                        }
+                    }
+                }
+
+                /*
+                 * Four-step FFT (Bailey). The input of size n = n1 * n2 is viewed as a matrix with n2 rows and n1
+                 * columns. Step 1 makes FFTs of size n2 over the columns and multiplies the results by twiddles
+                 * omega^(j1 * k2), writing them transposed into a temporary buffer. Step 2 makes FFTs of size n1
+                 * over the rows of the buffer and writes them back in the natural order.
+                 * Each sub-transform is done on a thread-local scratch buffer, so we have only 2 thread pool barriers
+                 * and 2 passes over the whole array instead of logn of them in basic_radix2_fft_cached.
+                 * Note that it's the caller's responsibility to multiply by 1/N.
+                 */
+                template<typename FieldType, typename Range>
+                void basic_radix2_fft_blocked(Range &a, const std::vector<typename FieldType::value_type> &omega_cache) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+                    BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
+
+                    const std::size_t n = a.size(), logn = log2(n);
+                    if (n != (1u << logn))
+                        throw std::invalid_argument("expected n == (1u << logn)");
+                    if (omega_cache.size() < n)
+                        throw std::invalid_argument("expected omega_cache.size() >= n");
+                    const std::size_t stride = omega_cache.size() / n;
+
+                    const std::size_t logn2 = (logn + 1) / 2, logn1 = logn - logn2;
+                    const std::size_t n2 = std::size_t(1) << logn2, n1 = std::size_t(1) << logn1;
+
+                    std::vector<value_type> tmp(n);
+
+                    // Thread pool of level LOW does not load the cores with chunks of < 4096 elements, so we split
+                    // the whole array and assign column c to the chunk containing element c * column_size.
+                    // Chunks form a partition of [0, n), so each column is processed exactly once.
+                    auto for_each_block = [n](std::size_t block_size, const auto &func) {
+                        parallel_for_chunks(
+                            n,
+                            [block_size, &func](std::size_t begin, std::size_t end) {
+                                for (std::size_t c = (begin + block_size - 1) / block_size; c * block_size < end; ++c) {
+                                    func(c);
+                                }
+                            }, ThreadPool::PoolLevel::LOW);
+                    };
+
+                    // Step 1: FFTs of size n2 over columns j1 of 'a', twiddles, transposed write into 'tmp'.
+                    for_each_block(n2, [&a, &tmp, &omega_cache, n1, n2, logn2, stride](std::size_t j1) {
+                        thread_local std::vector<value_type> scratch;
+                        scratch.resize(n2);
+                        for (std::size_t j2 = 0; j2 < n2; ++j2) {
+                            scratch[j2] = a[j1 + n1 * j2];
+                        }
+                        basic_radix2_fft_block<FieldType>(scratch.data(), logn2, omega_cache);
+                        // j1 * k2 < n1 * n2 = n, so the index never wraps around.
+                        tmp[j1 * n2] = scratch[0];
+                        for (std::size_t k2 = 1, idx = j1 * stride; k2 < n2; ++k2, idx += j1 * stride) {
+                            scratch[k2] *= omega_cache[idx];
+                            tmp[j1 * n2 + k2] = scratch[k2];
+                        }
+                    });
+
+                    // Step 2: FFTs of size n1 over columns k2 of 'tmp', X[k2 + n2 * k1] is written back into 'a'.
+                    for_each_block(n1, [&a, &tmp, &omega_cache, n1, n2, logn1](std::size_t k2) {
+                        thread_local std::vector<value_type> scratch;
+                        scratch.resize(n1);
+                        for (std::size_t j1 = 0; j1 < n1; ++j1) {
+                            scratch[j1] = tmp[j1 * n2 + k2];
+                        }
+                        basic_radix2_fft_block<FieldType>(scratch.data(), logn1, omega_cache);
+                        for (std::size_t k1 = 0; k1 < n1; ++k1) {
+                            a[k2 + n2 * k1] = scratch[k1];
+                        }
+                    });
+                }
+
+                /**
+                 * Chooses between the stage-parallel and the blocked FFT based on the size of the input.
+                 * Note that it's the caller's responsibility to multiply by 1/N.
+                 */
+                template<typename FieldType, typename Range>
+                void basic_radix2_fft_select(Range &a, const std::vector<typename FieldType::value_type> &omega_cache) {
+                    if (a.size() >= BLOCKED_FFT_MIN_SIZE) {
+                        basic_radix2_fft_blocked<FieldType>(a, omega_cache);
+                    } else {
+                        basic_radix2_fft_cached<FieldType>(a, omega_cache);
                     }
                 }
 
@@ -140,9 +285,9 @@ namespace nil {
                     if (omega_cache == nullptr) {
                         std::vector<typename FieldType::value_type> omega_powers;
                         create_fft_cache<FieldType>(a.size(), omega, omega_powers);
-                        basic_radix2_fft_cached<FieldType>(a, omega_powers);
+                        basic_radix2_fft_select<FieldType>(a, omega_powers);
                     } else {
-                        basic_radix2_fft_cached<FieldType>(a, *omega_cache);
+                        basic_radix2_fft_select<FieldType>(a, *omega_cache);
                     }
                 }
 
@@ -195,13 +340,18 @@ namespace nil {
                      */
 
                     const value_type Z = (t.pow(m)) - value_type::one();
-                    value_type l = Z * value_type(m).inversed();
                     value_type r = value_type::one();
                     for (std::size_t i = 0; i < m; ++i) {
-                        u[i] = l * (t - r).inversed();
-                        l *= omega;
+                        u[i] = t - r;
                         r *= omega;
                     }
+                    math::batch_inversion(u);
+
+                    value_type l = Z * value_type(m).inversed();
+                    for (std::size_t i = 0; i < m; ++i) {
+                        u[i] *= l;
+                        l *= omega;
+                    }
 
                     return u;
                 }
@@ -0,0 +1,217 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_EVALUATION_DOMAIN_REGISTRY_HPP
+#define CRYPTO3_MATH_EVALUATION_DOMAIN_REGISTRY_HPP
+
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * Process-wide registry of basic radix-2 evaluation domains for one field.
+             *
+             * Domains never change after construction, so the same object is handed out to everyone asking for
+             * the same size. Fft caches are shared too: the cache built for size N serves all the domains of sizes
+             * m <= N requested after it using every N/m-th power, so a proof computes the twiddles about once,
+             * for its largest domain. Domains created over a smaller cache before stay in the registry, as they
+             * may be in use, and keep their cache.
+             *
+             * The memory used by all the caches kept is bounded by 'memory_limit'. Domains which would need more
+             * are created as before and are not kept in the registry.
+             *
+             * The lock is held only to look up and update the map. The first request of a size inserts a
+             * placeholder and builds the domain, with its cache if needed, outside of the lock; concurrent
+             * requests of the same size wait for it. Building the cache runs parallel_for_chunks, whose waiting
+             * thread runs only its own chunks, so it never comes back here and waits for itself.
+             */
+            template<typename FieldType, typename ValueType = typename FieldType::value_type>
+            class evaluation_domain_registry {
+            public:
+                typedef basic_radix2_domain<FieldType, ValueType> domain_type;
+                typedef typename domain_type::cache_type cache_type;
+                typedef std::shared_ptr<evaluation_domain<FieldType, ValueType>> domain_ptr_type;
+
+                // 2^26 elements of 256 bit fields, both direct and inverse twiddles.
+                static constexpr std::size_t DEFAULT_MEMORY_LIMIT = std::size_t(1) << 32;
+
+                struct statistics {
+                    std::size_t hits = 0;
+                    std::size_t misses = 0;
+                    // Number of fft caches computed, including the ones which were not kept due to the memory limit.
+                    std::size_t caches_built = 0;
+                    // Memory used by the fft caches kept.
+                    std::size_t cache_bytes = 0;
+                };
+
+                static evaluation_domain_registry &get_instance() {
+                    static evaluation_domain_registry instance;
+                    return instance;
+                }
+
+                evaluation_domain_registry(const evaluation_domain_registry &obj) = delete;
+                evaluation_domain_registry &operator=(const evaluation_domain_registry &obj) = delete;
+
+                /**
+                 * Returns the shared domain of size m. The caller must check with detail::is_basic_radix2_domain
+                 * that m is a valid size.
+                 */
+                domain_ptr_type get(const std::size_t m) {
+                    std::promise<domain_ptr_type> promise;
+                    std::shared_future<domain_ptr_type> future;
+                    std::shared_ptr<const cache_type> cache;
+                    bool found;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+
+                        auto it = domains.find(m);
+                        found = it != domains.end();
+                        if (found) {
+                            ++stats.hits;
+                            future = it->second.domain;
+                        } else {
+                            ++stats.misses;
+                            future = promise.get_future().share();
+                            domains.emplace(m, entry {future, &promise});
+                            if (fft_cache && fft_cache->first.size() >= m) {
+                                cache = fft_cache;
+                            }
+                        }
+                    }
+                    if (found) {
+                        // Waits for the request which inserted the placeholder, rethrows if it failed.
+                        return future.get();
+                    }
+
+                    domain_ptr_type result;
+                    const bool new_cache = !cache;
+                    try {
+                        if (new_cache) {
+                            cache = domain_type::make_fft_cache(m);
+                        }
+                        result = std::make_shared<domain_type>(m, cache);
+                    } catch (...) {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            erase_placeholder(m, &promise);
+                        }
+                        promise.set_exception(std::current_exception());
+                        throw;
+                    }
+                    promise.set_value(result);
+
+                    if (new_cache) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        ++stats.caches_built;
+                        if (stats.cache_bytes + cache_bytes(m) <= memory_limit) {
+                            stats.cache_bytes += cache_bytes(m);
+                            if (!fft_cache || fft_cache->first.size() < m) {
+                                fft_cache = std::move(cache);
+                            }
+                        } else {
+                            // The requests waiting for the placeholder get this domain, the next ones build their own.
+                            erase_placeholder(m, &promise);
+                        }
+                    }
+                    return result;
+                }
+
+                void set_memory_limit(const std::size_t bytes) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    memory_limit = bytes;
+                    if (fft_cache && stats.cache_bytes > memory_limit) {
+                        clear_unlocked();
+                    }
+                }
+
+                /**
+                 * Releases all the domains and the fft cache held by the registry. Domains already handed out
+                 * stay valid.
+                 */
+                void clear() {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    clear_unlocked();
+                }
+
+                statistics get_statistics() const {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    return stats;
+                }
+
+                void reset_statistics() {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    const std::size_t bytes = stats.cache_bytes;
+                    stats = statistics();
+                    stats.cache_bytes = bytes;
+                }
+
+            private:
+                evaluation_domain_registry() = default;
+
+                static std::size_t cache_bytes(const std::size_t m) {
+                    return 2 * m * sizeof(typename FieldType::value_type);
+                }
+
+                // Erases the domain of size m if it is still the one inserted by the request with 'owner' promise,
+                // the registry may have been cleared meanwhile.
+                void erase_placeholder(const std::size_t m, const void *owner) {
+                    auto it = domains.find(m);
+                    if (it != domains.end() && it->second.owner == owner) {
+                        domains.erase(it);
+                    }
+                }
+
+                void clear_unlocked() {
+                    domains.clear();
+                    fft_cache.reset();
+                    stats.cache_bytes = 0;
+                }
+
+                struct entry {
+                    std::shared_future<domain_ptr_type> domain;
+                    // The promise of the request which builds the domain, only compared.
+                    const void *owner;
+                };
+
+                mutable std::mutex mutex;
+                std::unordered_map<std::size_t, entry> domains;
+                std::shared_ptr<const cache_type> fft_cache;
+                std::size_t memory_limit = DEFAULT_MEMORY_LIMIT;
+                statistics stats;
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_EVALUATION_DOMAIN_REGISTRY_HPP
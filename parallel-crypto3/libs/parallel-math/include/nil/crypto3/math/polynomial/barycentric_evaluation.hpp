@@ -0,0 +1,227 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_BARYCENTRIC_EVALUATION_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_BARYCENTRIC_EVALUATION_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/math/algorithms/batch_inversion.hpp>
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * Barycentric weights of a point z over the radix-2 domain {w^i} of size n, used to evaluate polynomials
+             * given by their values on the domain without going back to the coefficients:
+             *
+             *     f(z) = (z^n - 1) / n * sum_i f(w^i) * w^i / (z - w^i)
+             *
+             * The weights, including the constant factor, are computed once with a single batch inversion, then every
+             * evaluation over the same domain and point is a dot product of n elements. If z belongs to the domain,
+             * no weights are stored and the evaluation is the value at the matching index.
+             */
+            template<typename FieldType, typename ValueType = typename FieldType::value_type>
+            class barycentric_weights {
+            public:
+                typedef ValueType value_type;
+
+                barycentric_weights(std::size_t domain_size, const value_type &point,
+                                    ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW)
+                    : _domain_size(domain_size), _point(point), _point_index(NOT_IN_DOMAIN) {
+                    BOOST_ASSERT_MSG(domain_size > 0, "Domain must not be empty");
+
+                    const value_type omega = unity_root<FieldType>(domain_size);
+                    const value_type vanishing = point.pow(domain_size) - value_type::one();
+
+                    if (vanishing.is_zero()) {
+                        std::atomic<std::size_t> index(NOT_IN_DOMAIN);
+                        parallel_for_chunks(
+                            domain_size,
+                            [this, &omega, &index](std::size_t begin, std::size_t end) {
+                                value_type omega_power = omega.pow(begin);
+                                for (std::size_t i = begin; i < end; ++i, omega_power *= omega) {
+                                    if (omega_power == _point) {
+                                        index = i;
+                                        return;
+                                    }
+                                }
+                            },
+                            pool_id);
+                        _point_index = index;
+                        BOOST_ASSERT_MSG(_point_index != NOT_IN_DOMAIN, "Root of unity is not in the domain");
+                        return;
+                    }
+
+                    // _weights holds the denominators z - w^i until they are inverted.
+                    _weights.resize(domain_size);
+                    parallel_for_chunks(
+                        domain_size,
+                        [this, &omega](std::size_t begin, std::size_t end) {
+                            value_type omega_power = omega.pow(begin);
+                            for (std::size_t i = begin; i < end; ++i, omega_power *= omega) {
+                                _weights[i] = _point - omega_power;
+                            }
+                        },
+                        pool_id);
+
+                    batch_inversion(_weights, pool_id);
+
+                    const value_type factor = vanishing * value_type(domain_size).inversed();
+                    parallel_for_chunks(
+                        domain_size,
+                        [this, &omega, &factor](std::size_t begin, std::size_t end) {
+                            value_type scaled_power = factor * omega.pow(begin);
+                            for (std::size_t i = begin; i < end; ++i, scaled_power *= omega) {
+                                _weights[i] *= scaled_power;
+                            }
+                        },
+                        pool_id);
+                }
+
+                std::size_t domain_size() const {
+                    return _domain_size;
+                }
+
+                const value_type &point() const {
+                    return _point;
+                }
+
+                /**
+                 * Returns true if the point is one of the domain elements.
+                 */
+                bool point_in_domain() const {
+                    return _point_index != NOT_IN_DOMAIN;
+                }
+
+                /**
+                 * Evaluates the polynomial given by its values on the domain at the point.
+                 * The dot product is split into chunks, small polynomials are evaluated by the calling thread.
+                 */
+                template<typename Range>
+                value_type evaluate(const Range &values,
+                                    ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) const {
+                    BOOST_ASSERT_MSG(values.size() == _domain_size, "Values size is not equal to the domain size");
+                    auto first = std::begin(values);
+                    if (point_in_domain()) {
+                        return first[_point_index];
+                    }
+
+                    std::vector<value_type> partial_sums(nil::crypto3::detail::chunks_count(_domain_size, pool_id),
+                                                         value_type::zero());
+                    parallel_for_chunks_with_thread_id(
+                        _domain_size,
+                        [this, first, &partial_sums](std::size_t thread_id, std::size_t begin, std::size_t end) {
+                            partial_sums[thread_id] = dot_product(first, begin, end);
+                        },
+                        pool_id);
+
+                    value_type result = value_type::zero();
+                    for (const auto &sum : partial_sums) {
+                        result += sum;
+                    }
+                    return result;
+                }
+
+                /**
+                 * Same as 'evaluate', but always runs in the calling thread. Use it when the polynomials themselves
+                 * are processed in parallel.
+                 */
+                template<typename Range>
+                value_type evaluate_serial(const Range &values) const {
+                    BOOST_ASSERT_MSG(values.size() == _domain_size, "Values size is not equal to the domain size");
+                    auto first = std::begin(values);
+                    if (point_in_domain()) {
+                        return first[_point_index];
+                    }
+                    return dot_product(first, 0, _domain_size);
+                }
+
+            private:
+                static constexpr std::size_t NOT_IN_DOMAIN = std::numeric_limits<std::size_t>::max();
+
+                template<typename Iterator>
+                value_type dot_product(Iterator first, std::size_t begin, std::size_t end) const {
+                    value_type result = value_type::zero();
+                    for (std::size_t i = begin; i < end; ++i) {
+                        result += first[i] * _weights[i];
+                    }
+                    return result;
+                }
+
+                std::size_t _domain_size;
+                value_type _point;
+                std::size_t _point_index;
+                std::vector<value_type> _weights;
+            };
+
+            /**
+             * Evaluates every polynomial of 'polys' at 'point'. Polynomials must be given by their values on radix-2
+             * domains. The weights are computed once for every distinct domain size and shared by all the
+             * polynomials of that size.
+             */
+            template<typename FieldType, typename PolysRange>
+            std::vector<typename FieldType::value_type> barycentric_evaluate(
+                    const PolysRange &polys, const typename FieldType::value_type &point) {
+                typedef barycentric_weights<FieldType> weights_type;
+
+                std::vector<weights_type> weights;
+                std::vector<std::size_t> weights_index;
+                weights_index.reserve(polys.size());
+                for (const auto &poly : polys) {
+                    std::size_t j = 0;
+                    while (j < weights.size() && weights[j].domain_size() != poly.size()) {
+                        ++j;
+                    }
+                    if (j == weights.size()) {
+                        weights.emplace_back(poly.size(), point);
+                    }
+                    weights_index.push_back(j);
+                }
+
+                std::vector<typename FieldType::value_type> result(weights_index.size());
+                auto first = std::begin(polys);
+                // We use HIGH level thread pool here, one polynomial is evaluated per task.
+                parallel_for(0, result.size(), [&result, &weights, &weights_index, first](std::size_t i) {
+                    result[i] = weights[weights_index[i]].evaluate_serial(first[i]);
+                }, ThreadPool::PoolLevel::HIGH);
+                return result;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_BARYCENTRIC_EVALUATION_HPP
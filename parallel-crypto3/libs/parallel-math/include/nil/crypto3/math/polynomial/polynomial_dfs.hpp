@@ -37,6 +37,7 @@
 
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/polynomial/barycentric_evaluation.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
@@ -370,15 +371,13 @@ namespace nil {
                     std::swap(_d, other._d);
                 }
 
+                /**
+                 * Evaluates the polynomial at 'value' with the barycentric formula, without the inverse FFT.
+                 * To evaluate many polynomials at the same point use 'barycentric_weights' directly.
+                 */
                 FieldValueType evaluate(const FieldValueType& value) const {
-                    std::vector<FieldValueType> tmp = this->coefficients();
-                    FieldValueType result = FieldValueType::zero();
-                    auto end = tmp.end();
-                    // TODO(martun): parallelize the lower loop.
-                    while (end != tmp.begin()) {
-                        result = result * value + *--end;
-                    }
-                    return result;
+                    typedef typename value_type::field_type FieldType;
+                    return barycentric_weights<FieldType, FieldValueType>(this->size(), value).evaluate(this->val);
                 }
 
                 /**
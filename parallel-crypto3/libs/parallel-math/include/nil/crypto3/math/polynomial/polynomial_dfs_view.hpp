@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <vector>
 
+#include <nil/crypto3/math/polynomial/barycentric_evaluation.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 #include <string_view>
 
@@ -332,14 +333,8 @@ namespace nil {
                 //                }
 
                 FieldValueType evaluate(const FieldValueType& value) const {
-
-                    std::vector<FieldValueType> tmp = this->coefficients();
-                    FieldValueType result = 0;
-                    auto end = tmp.end();
-                    while (end != tmp.begin()) {
-                        result = result * value + *--end;
-                    }
-                    return result;
+                    typedef typename value_type::field_type FieldType;
+                    return barycentric_weights<FieldType, FieldValueType>(this->size(), value).evaluate(it);
                 }
 
                 /**
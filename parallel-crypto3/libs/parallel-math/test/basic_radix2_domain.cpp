@@ -26,6 +26,7 @@
 
 #include <vector>
 #include <cstdint>
+#include <numeric>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -149,4 +150,43 @@ BOOST_AUTO_TEST_CASE(fft_vs_multiplication_benchmark) {
              << " ms" << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(blocked_fft_matches_stage_parallel_fft) {
+    using value_type = FieldType::value_type;
+
+    for (std::size_t log_size = 1; log_size <= 13; ++log_size) {
+        const std::size_t fft_size = 1 << log_size;
+        std::vector<value_type> stage_parallel(fft_size);
+        for (std::size_t i = 0; i < fft_size; ++i) {
+            stage_parallel[i] = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        std::vector<value_type> blocked(stage_parallel);
+
+        std::vector<value_type> omega_cache;
+        nil::crypto3::math::detail::create_fft_cache<FieldType>(
+            fft_size, unity_root<FieldType>(fft_size), omega_cache);
+
+        nil::crypto3::math::detail::basic_radix2_fft_cached<FieldType>(stage_parallel, omega_cache);
+        nil::crypto3::math::detail::basic_radix2_fft_blocked<FieldType>(blocked, omega_cache);
+
+        BOOST_CHECK_MESSAGE(stage_parallel == blocked, "FFT mismatch for size 2^" << log_size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(blocked_fft_inverse_test) {
+    using value_type = FieldType::value_type;
+    const std::size_t fft_size = detail::BLOCKED_FFT_MIN_SIZE;
+
+    basic_radix2_domain<FieldType> domain(fft_size);
+    std::vector<value_type> a(fft_size);
+    for (std::size_t i = 0; i < fft_size; ++i) {
+        a[i] = nil::crypto3::algebra::random_element<FieldType>();
+    }
+    std::vector<value_type> b(a);
+
+    domain.fft(b);
+    BOOST_CHECK(b[0] == std::accumulate(a.begin(), a.end(), value_type::zero()));
+    domain.inverse_fft(b);
+    BOOST_CHECK(a == b);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
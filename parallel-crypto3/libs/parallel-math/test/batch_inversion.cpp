@@ -0,0 +1,85 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE batch_inversion_test
+
+#include <vector>
+#include <random>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/fields/pallas/base_field.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/algorithms/batch_inversion.hpp>
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+template<typename FieldType>
+void test_batch_inversion(std::size_t size) {
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<value_type> values(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        // Every 5th value is zero, zeros must be kept as they are.
+        values[i] = (i % 5 == 3) ? value_type::zero() : random_element<FieldType>();
+    }
+
+    std::vector<value_type> inverses = values;
+    batch_inversion(inverses);
+
+    for (std::size_t i = 0; i < size; ++i) {
+        if (values[i].is_zero()) {
+            BOOST_CHECK(inverses[i].is_zero());
+        } else {
+            BOOST_CHECK(inverses[i] == values[i].inversed());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(batch_inversion_test_suite)
+
+BOOST_AUTO_TEST_CASE(batch_inversion_empty) {
+    std::vector<typename fields::pallas_base_field::value_type> values;
+    batch_inversion(values);
+    BOOST_CHECK(values.empty());
+}
+
+BOOST_AUTO_TEST_CASE(batch_inversion_pallas) {
+    for (std::size_t size : {1, 2, 17, 4096, 10000}) {
+        test_batch_inversion<fields::pallas_base_field>(size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(batch_inversion_bls12) {
+    for (std::size_t size : {1, 3, 5000}) {
+        test_batch_inversion<fields::bls12_fr<381>>(size);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
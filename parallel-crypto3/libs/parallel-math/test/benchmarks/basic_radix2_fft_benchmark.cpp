@@ -0,0 +1,184 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE basic_radix2_fft_benchmark_test
+
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/extended_p_square_quantile.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/timer/progress_display.hpp>
+#include <boost/timer/timer.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/vesta.hpp>
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+#include <nil/crypto3/random/algebraic_engine.hpp>
+
+
+// Benchmark test cases integrated to Boost.Test framework, check the examples below
+struct test_case_base {
+    using MeanQuantileAccumulatorSet = boost::accumulators::accumulator_set<
+        double,
+        boost::accumulators::features<
+            boost::accumulators::tag::mean,
+            boost::accumulators::tag::extended_p_square_quantile
+        >
+    >;
+
+    std::map<std::string, boost::timer::cpu_timer> timers;
+    std::map<std::string, MeanQuantileAccumulatorSet> accumulators;
+    std::vector<double> probs = {0.5, 0.9, 0.95, 0.99};
+
+    void run_benchmark_iterations(
+        int num_iterations,
+        std::function<void()> benchmark_impl
+    ) {
+        boost::timer::progress_display progress_bar(num_iterations);
+        for (int i = 0; i < num_iterations; ++i) {
+            benchmark_impl();
+            for (const auto& [flag, timer] : timers) {
+                auto acc = accumulators.emplace(
+                    std::piecewise_construct,
+                    std::forward_as_tuple(flag),
+                    std::forward_as_tuple(boost::accumulators::extended_p_square_probabilities = probs)
+                );
+                acc.first->second(timer.elapsed().wall * 1.0e-9);
+            }
+            timers.clear();
+            ++progress_bar;
+        }
+    }
+
+    void report_results() {
+        using namespace boost::accumulators;
+        for (const auto& acc : accumulators) {
+            std::cout << "Results for " << acc.first << ":\n"
+                << " Mean time: " << std::fixed << std::setprecision(3) << mean(acc.second) << " seconds\n"
+                << " Percentiles:\n" << std::fixed;
+            for (auto prob : probs) {
+                std::cout << "  " << std::setprecision(0) << prob * 100 << "th: "
+                    << std::setprecision(3) << quantile(acc.second, quantile_probability = prob) << " seconds\n";
+            }
+            std::cout << "\n";
+        }
+    }
+};
+
+#define BENCHMARK_FIXTURE_TEST_CASE(test_case_name, num_iterations, fixture) \
+    struct test_case_name : public fixture, test_case_base {                 \
+        void test_method();                                                  \
+    };                                                                       \
+    static void BOOST_AUTO_TC_INVOKER( test_case_name )()                    \
+    {                                                                        \
+        test_case_name t;                                                    \
+        t.run_benchmark_iterations(                                          \
+            num_iterations, [&]() { t.test_method(); });                     \
+        t.report_results();                                                  \
+    }                                                                        \
+    struct BOOST_AUTO_TC_UNIQUE_ID( test_case_name ) {};                     \
+    BOOST_AUTO_TU_REGISTRAR(test_case_name)(                                 \
+        boost::unit_test::make_test_case(                                    \
+            &BOOST_AUTO_TC_INVOKER( test_case_name ),                        \
+            #test_case_name, __FILE__, __LINE__),                            \
+        boost::unit_test::decorator::collector_t::instance()                 \
+    );                                                                       \
+    void test_case_name::test_method()
+
+#define BENCHMARK_AUTO_TEST_CASE(test_case_name, num_iterations) \
+    BENCHMARK_FIXTURE_TEST_CASE(test_case_name, num_iterations, BOOST_AUTO_TEST_CASE_FIXTURE)
+
+#define START_TIMER(flag) timers[flag].resume();
+
+#define STOP_TIMER(flag) timers[flag].stop();
+
+
+using namespace nil::crypto3::math;
+
+// Compares the stage-parallel FFT (one thread pool barrier per butterfly stage) with the blocked four-step FFT.
+template<typename FieldType>
+struct fft_benchmark_fixture {
+    using value_type = typename FieldType::value_type;
+
+    const std::size_t SEED = 1337;
+    const std::size_t MIN_LOG_SIZE = 16;
+    const std::size_t MAX_LOG_SIZE = 26;
+
+    fft_benchmark_fixture() : alg_rnd_engine(SEED) {}
+
+    void run(const std::string &field_name, std::map<std::string, boost::timer::cpu_timer> &timers) {
+        for (std::size_t log_size = MIN_LOG_SIZE; log_size <= MAX_LOG_SIZE; ++log_size) {
+            const std::size_t size = 1ul << log_size;
+            std::vector<value_type> data(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                data[i] = alg_rnd_engine();
+            }
+            std::vector<value_type> omega_cache;
+            detail::create_fft_cache<FieldType>(size, unity_root<FieldType>(size), omega_cache);
+
+            const std::string suffix = " " + field_name + " 2^" + std::to_string(log_size);
+
+            std::vector<value_type> stage_parallel(data);
+            timers["stage_parallel" + suffix].start();
+            detail::basic_radix2_fft_cached<FieldType>(stage_parallel, omega_cache);
+            timers["stage_parallel" + suffix].stop();
+
+            std::vector<value_type> blocked(std::move(data));
+            timers["blocked" + suffix].start();
+            detail::basic_radix2_fft_blocked<FieldType>(blocked, omega_cache);
+            timers["blocked" + suffix].stop();
+
+            BOOST_CHECK(stage_parallel == blocked);
+        }
+    }
+
+    nil::crypto3::random::algebraic_engine<FieldType> alg_rnd_engine;
+};
+
+struct F {};
+
+BOOST_FIXTURE_TEST_SUITE(basic_radix2_fft_benchmark_test_suite, F)
+
+BENCHMARK_AUTO_TEST_CASE(pallas_fft_test, 3) {
+    fft_benchmark_fixture<nil::crypto3::algebra::curves::pallas::scalar_field_type> fixture;
+    fixture.run("pallas", timers);
+}
+
+BENCHMARK_AUTO_TEST_CASE(bls12_381_fft_test, 3) {
+    fft_benchmark_fixture<nil::crypto3::algebra::curves::bls12<381>::scalar_field_type> fixture;
+    fixture.run("bls12-381", timers);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -56,11 +56,14 @@
 #include <nil/crypto3/math/domains/extended_radix2_domain.hpp>
 #include <nil/crypto3/math/domains/geometric_sequence_domain.hpp>
 #include <nil/crypto3/math/domains/step_radix2_domain.hpp>
+#include <nil/crypto3/math/domains/evaluation_domain_registry.hpp>
 
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 
 #include <nil/crypto3/math/polynomial/evaluate.hpp>
 
+#include <nil/actor/core/parallelization_utils.hpp>
+
 #include <typeinfo>
 
 using namespace nil::crypto3::algebra;
@@ -538,4 +541,84 @@ BOOST_AUTO_TEST_CASE(get_vanishing_polynomial) {
                             arithmetic_sequence_domain<field_type>>(4);
 }
 
+BOOST_AUTO_TEST_CASE(evaluation_domain_registry_test) {
+    typedef curves::bls12<381>::scalar_field_type field_type;
+    typedef typename field_type::value_type value_type;
+    typedef evaluation_domain_registry<field_type> registry_type;
+
+    registry_type &registry = registry_type::get_instance();
+    registry.clear();
+    registry.reset_statistics();
+
+    auto big_domain = make_evaluation_domain<field_type>(64);
+    auto big_domain_again = make_evaluation_domain<field_type>(64);
+    BOOST_CHECK(big_domain == big_domain_again);
+
+    // The small domain strides over the fft cache of the big one.
+    auto small_domain = make_evaluation_domain<field_type>(16);
+
+    registry_type::statistics stats = registry.get_statistics();
+    BOOST_CHECK_EQUAL(stats.hits, 1);
+    BOOST_CHECK_EQUAL(stats.misses, 2);
+    BOOST_CHECK_EQUAL(stats.caches_built, 1);
+    BOOST_CHECK_EQUAL(stats.cache_bytes, 2 * 64 * sizeof(value_type));
+
+    basic_radix2_domain<field_type> standalone_domain(16);
+    std::vector<value_type> a(16), b;
+    for (std::size_t i = 0; i < a.size(); i++) {
+        a[i] = random_element<field_type>();
+    }
+    b = a;
+    small_domain->fft(a);
+    standalone_domain.fft(b);
+    BOOST_CHECK(a == b);
+    small_domain->inverse_fft(a);
+    standalone_domain.inverse_fft(b);
+    BOOST_CHECK(a == b);
+
+    // Domains which need a cache over the limit are not kept.
+    registry.set_memory_limit(2 * 64 * sizeof(value_type));
+    auto huge_domain = make_evaluation_domain<field_type>(128);
+    auto huge_domain_again = make_evaluation_domain<field_type>(128);
+    BOOST_CHECK(huge_domain != huge_domain_again);
+    BOOST_CHECK(make_evaluation_domain<field_type>(16) == small_domain);
+
+    registry.set_memory_limit(registry_type::DEFAULT_MEMORY_LIMIT);
+    registry.clear();
+}
+
+BOOST_AUTO_TEST_CASE(evaluation_domain_registry_concurrent_test) {
+    typedef curves::bls12<381>::scalar_field_type field_type;
+    typedef typename field_type::value_type value_type;
+    typedef evaluation_domain_registry<field_type> registry_type;
+
+    registry_type &registry = registry_type::get_instance();
+    registry.clear();
+
+    // Tasks of the pool request domains whose caches are built with parallel_for_chunks, in increasing and
+    // decreasing order of sizes, so the requests of the same size wait for each other.
+    const std::size_t requests = 32;
+    std::vector<std::shared_ptr<evaluation_domain<field_type>>> domains(requests);
+    nil::crypto3::parallel_for(0, requests, [&domains](std::size_t i) {
+        domains[i] = make_evaluation_domain<field_type>(std::size_t(1) << (13 + (i % 2 ? i % 4 : 3 - i % 4)));
+    }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+
+    for (std::size_t i = 0; i < requests; ++i) {
+        BOOST_CHECK(domains[i] == domains[i % 4]);
+    }
+
+    // Whichever cache the domain was built over, it gives the same result as a standalone one.
+    std::vector<value_type> a(1 << 13), b;
+    for (std::size_t i = 0; i < a.size(); i++) {
+        a[i] = random_element<field_type>();
+    }
+    b = a;
+    basic_radix2_domain<field_type> standalone_domain(a.size());
+    make_evaluation_domain<field_type>(a.size())->fft(a);
+    standalone_domain.fft(b);
+    BOOST_CHECK(a == b);
+
+    registry.clear();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
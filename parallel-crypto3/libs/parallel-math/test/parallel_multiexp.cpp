@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE parallel_multiexp_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+#include <nil/crypto3/math/algorithms/parallel_multiexp.hpp>
+
+using namespace nil::crypto3::algebra;
+
+// sum(points[i] * scalars[i]) with the integral scalar multiplication, which does not use the GLV method as
+// BDLO12 and the parallel method do.
+template<typename GroupType>
+typename GroupType::value_type naive_multiexp(
+        const std::vector<typename GroupType::value_type> &points,
+        const std::vector<typename GroupType::params_type::scalar_field_type::value_type> &scalars) {
+    typedef typename GroupType::params_type::scalar_field_type::integral_type integral_type;
+
+    typename GroupType::value_type result = GroupType::value_type::zero();
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        typename GroupType::value_type term = points[i];
+        curves::detail::scalar_mul_inplace(term, static_cast<integral_type>(scalars[i].data));
+        result += term;
+    }
+    return result;
+}
+
+template<typename GroupType>
+void test_parallel_multiexp(std::size_t size) {
+    typedef typename GroupType::value_type point_type;
+    typedef typename GroupType::params_type::scalar_field_type scalar_field_type;
+    typedef typename scalar_field_type::value_type scalar_type;
+
+    std::vector<point_type> points(size);
+    std::vector<scalar_type> scalars(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        points[i] = random_element<GroupType>();
+        scalars[i] = random_element<scalar_field_type>();
+    }
+    // Zeros, equal and opposite points in the same buckets take the special cases of the affine additions.
+    if (size > 6) {
+        points[1] = points[0];
+        points[2] = -points[0];
+        scalars[1] = scalars[2] = scalars[0];
+        points[3] = point_type::zero();
+        scalars[4] = scalar_type::zero();
+        scalars[5] = -scalar_type::one();
+    }
+
+    point_type expected = policies::multiexp_method_BDLO12::process(
+        points.begin(), points.end(), scalars.begin(), scalars.end());
+    point_type result = policies::multiexp_method_parallel_pippenger::process(
+        points.begin(), points.end(), scalars.begin(), scalars.end());
+    BOOST_CHECK(result == expected);
+    // The large inputs are there for the bucket blocks, the naive sum would only slow the test down.
+    if (size <= 3000) {
+        BOOST_CHECK(result == naive_multiexp<GroupType>(points, scalars));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(parallel_multiexp_test_suite)
+
+BOOST_AUTO_TEST_CASE(parallel_multiexp_empty) {
+    typedef curves::bls12_381::g1_type<>::value_type point_type;
+    std::vector<point_type> points;
+    std::vector<curves::bls12_381::scalar_field_type::value_type> scalars;
+    point_type result = policies::multiexp_method_parallel_pippenger::process(
+        points.begin(), points.end(), scalars.begin(), scalars.end());
+    BOOST_CHECK(result.is_zero());
+}
+
+BOOST_AUTO_TEST_CASE(parallel_multiexp_bls12_381_g1) {
+    for (std::size_t size : {1, 2, 7, 100, 3000}) {
+        test_parallel_multiexp<curves::bls12_381::g1_type<>>(size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_multiexp_bls12_381_g2) {
+    for (std::size_t size : {1, 33}) {
+        test_parallel_multiexp<curves::bls12_381::g2_type<>>(size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_multiexp_pallas) {
+    for (std::size_t size : {5, 1000}) {
+        test_parallel_multiexp<curves::pallas::g1_type<>>(size);
+    }
+}
+
+// More points than one block of detail::affine_bucket_sums, so the bucket sums are carried between the blocks.
+BOOST_AUTO_TEST_CASE(parallel_multiexp_multiple_blocks) {
+    test_parallel_multiexp<curves::bls12_381::g1_type<>>(20000);
+    test_parallel_multiexp<curves::pallas::g1_type<>>(20000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
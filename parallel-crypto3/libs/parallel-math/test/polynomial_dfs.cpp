@@ -37,6 +37,7 @@
 #include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/polynomial/barycentric_evaluation.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
@@ -1305,6 +1306,41 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_evaluate_after_resize_and_shift_test) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(polynomial_dfs_barycentric_evaluation_test) {
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<polynomial_dfs<value_type>> polys;
+    std::vector<polynomial<value_type>> coefficients;
+    for (std::size_t size : {1, 8, 64, 8192}) {
+        std::vector<value_type> coeffs(size);
+        for (auto &c : coeffs) {
+            c = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        polynomial_dfs<value_type> poly;
+        poly.from_coefficients(coeffs);
+        polys.push_back(poly);
+        coefficients.push_back(polynomial<value_type>(coeffs));
+    }
+
+    value_type point = nil::crypto3::algebra::random_element<FieldType>();
+    std::vector<value_type> batch_result = barycentric_evaluate<FieldType>(polys, point);
+    BOOST_CHECK_EQUAL(batch_result.size(), polys.size());
+    for (std::size_t i = 0; i < polys.size(); i++) {
+        BOOST_CHECK(polys[i].evaluate(point) == coefficients[i].evaluate(point));
+        BOOST_CHECK(batch_result[i] == coefficients[i].evaluate(point));
+    }
+
+    // Points of the domain give the stored values.
+    const polynomial_dfs<value_type> &poly = polys.back();
+    value_type omega = unity_root<FieldType>(poly.size());
+    for (std::size_t i : {0, 1, 4095, 8191}) {
+        barycentric_weights<FieldType> weights(poly.size(), omega.pow(i));
+        BOOST_CHECK(weights.point_in_domain());
+        BOOST_CHECK(weights.evaluate(poly) == poly[i]);
+        BOOST_CHECK(poly.evaluate(omega.pow(i)) == coefficients.back().evaluate(omega.pow(i)));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(polynomial_dfs_zero_one_test) {
     polynomial_dfs<typename FieldType::value_type> small_poly = {
         3,
@@ -34,6 +34,8 @@
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
+#include <nil/crypto3/math/type_traits.hpp>
+#include <nil/crypto3/math/polynomial/barycentric_evaluation.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
 
@@ -208,8 +210,38 @@ namespace nil {
                         return eval_map;
                     }
 
+                    // Returns the index of the barycentric weights for the given domain size and point in 'weights',
+                    // computes them if they are not there yet.
+                    static std::size_t get_weights_index(
+                            std::vector<math::barycentric_weights<field_type>> &weights,
+                            std::size_t domain_size, const typename field_type::value_type &point) {
+                        for (std::size_t w = 0; w < weights.size(); w++) {
+                            if (weights[w].domain_size() == domain_size && weights[w].point() == point) {
+                                return w;
+                            }
+                        }
+                        weights.emplace_back(domain_size, point);
+                        return weights.size() - 1;
+                    }
+
                     void eval_polys() {
-                        for(auto const &[k, poly] : _polys) {
+                        // One task per (batch, polynomial, point). The polynomials are referenced in place, all the
+                        // tasks of all the batches are scheduled at once.
+                        struct eval_task {
+                            std::size_t batch_id;
+                            std::size_t poly_id;
+                            std::size_t point_id;
+                            const polynomial_type *poly;
+                            const typename field_type::value_type *point;
+                            std::size_t weights_id;
+                        };
+
+                        // Polynomials in evaluation form are evaluated with the barycentric formula, the weights are
+                        // computed once per distinct (domain size, point) and shared by all the batches.
+                        std::vector<math::barycentric_weights<field_type>> weights;
+                        std::vector<eval_task> tasks;
+
+                        for (auto const &[k, poly] : _polys) {
                             _z.set_batch_size(k, poly.size());
                             auto const &point = _points.at(k);
 
@@ -217,18 +249,30 @@ namespace nil {
 
                             for (std::size_t i = 0; i < poly.size(); ++i) {
                                 _z.set_poly_points_number(k, i, point[i].size());
+                                for (std::size_t j = 0; j < point[i].size(); j++) {
+                                    std::size_t weights_id = 0;
+                                    if constexpr (math::is_polynomial_dfs<polynomial_type>::value) {
+                                        weights_id = get_weights_index(weights, poly[i].size(), point[i][j]);
+                                    }
+                                    tasks.push_back({k, i, j, &poly[i], &point[i][j], weights_id});
+                                }
                             }
+                        }
 
-                            // Lambda in parallel_for can not capture structured bindings [k, poly], until C++20
-                            auto k_capture = k;
-                            auto poly_capture = poly;
+                        std::vector<typename field_type::value_type> values(tasks.size());
+                        // We use HIGH level thread pool here, because "evaluate" may use the lower level one.
+                        parallel_for(0, tasks.size(), [&tasks, &weights, &values](std::size_t t) {
+                            const eval_task &task = tasks[t];
+                            if constexpr (math::is_polynomial_dfs<polynomial_type>::value) {
+                                values[t] = weights[task.weights_id].evaluate_serial(*task.poly);
+                            } else {
+                                values[t] = task.poly->evaluate(*task.point);
+                            }
+                        }, ThreadPool::PoolLevel::HIGH);
 
-                            // We use HIGH level thread pool here, because "evaluate" may use the lower level one.
-                            parallel_for(0, poly.size(), [this, &point, k_capture, &poly_capture](std::size_t i) {
-                                for (std::size_t j = 0; j < point[i].size(); j++) {
-                                    _z.set(k_capture, i, j, poly_capture[i].evaluate(point[i][j]));
-                                }
-                            }, ThreadPool::PoolLevel::HIGH);
+                        // Storage is filled by the calling thread, it is not safe for concurrent writes.
+                        for (std::size_t t = 0; t < tasks.size(); t++) {
+                            _z.set(tasks[t].batch_id, tasks[t].poly_id, tasks[t].point_id, values[t]);
                         }
                     }
 
@@ -33,6 +33,7 @@
 
 #include <boost/log/trivial.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <map>
@@ -52,6 +53,7 @@
 
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/fold_polynomial.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/lde_store.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/proof_of_work.hpp>
 #include <nil/crypto3/zk/detail/field_element_consumer.hpp>
 
@@ -400,6 +402,85 @@ namespace nil {
                     return (x_index + domain_size / FRI::m) % domain_size;
                 }
 
+                // Fills 's_indices' with the pairs of evaluation indices stored in the leaf 'x_index', in the order
+                // they are written to the leaf. 's_indices' must have coset_size / FRI::m entries.
+                template<typename FRI>
+                static inline void get_leaf_indices(const std::size_t x_index, const std::size_t domain_size,
+                                                    std::vector<std::array<std::size_t, FRI::m>> &s_indices) {
+                    s_indices[0][0] = x_index;
+                    s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
+
+                    std::size_t base_index = domain_size / (FRI::m * FRI::m);
+                    std::size_t prev_half_size = 1;
+                    std::size_t i = 1;
+                    while (i < s_indices.size()) {
+                        for (std::size_t j = 0; j < prev_half_size; j++) {
+                            s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
+                            s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
+                            i++;
+                        }
+                        base_index /= FRI::m;
+                        prev_half_size <<= 1;
+                    }
+                }
+
+                /**
+                 * Commits to 'list_size' polynomials of size 'domain_size', one leaf per coset with the evaluations
+                 * of all the polynomials. Leaves are serialized into a few scratch buffers and hashed right away,
+                 * several at once with hash_batch, so only a handful of leaves per thread are in memory instead of
+                 * a copy of all the evaluations.
+                 */
+                template<typename FRI>
+                static typename FRI::precommitment_type
+                precommit_cosets(const math::polynomial_dfs<typename FRI::field_type::value_type> *poly,
+                                 const std::size_t list_size, const std::size_t domain_size, const std::size_t fri_step) {
+                    typedef typename FRI::merkle_tree_type::value_type digest_type;
+
+                    std::size_t coset_size = 1 << fri_step;
+                    std::size_t leafs_number = domain_size / coset_size;
+
+                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(
+                        leafs_number,
+                        [poly, list_size, domain_size, coset_size](std::size_t begin, std::size_t end, auto out) {
+                            std::vector<detail::fri_field_element_consumer<FRI>> leaves(
+                                containers::detail::HASH_BATCH_SIZE,
+                                detail::fri_field_element_consumer<FRI>(coset_size * list_size));
+                            std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
+
+                            for (std::size_t batch_begin = begin; batch_begin < end; batch_begin += leaves.size()) {
+                                const std::size_t count = std::min(leaves.size(), end - batch_begin);
+                                for (std::size_t k = 0; k < count; ++k) {
+                                    get_leaf_indices<FRI>(batch_begin + k, domain_size, s_indices);
+
+                                    auto &element_consumer = leaves[k].reset_cursor();
+                                    for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
+                                        for (const auto &pair : s_indices) {
+                                            element_consumer.consume(poly[polynom_index][pair[0]]);
+                                            element_consumer.consume(poly[polynom_index][pair[1]]);
+                                        }
+                                    }
+                                }
+                                digest_type *digests = &*(out + (batch_begin - begin));
+                                containers::detail::compute_leaf_hashes<typename FRI::merkle_tree_hash_type>(
+                                    leaves.begin(), leaves.begin() + count, digests);
+                            }
+                        });
+                }
+
+                /**
+                 * Resizes all the polynomials of 'poly' to the domain D, which is the LDE committed by precommit.
+                 */
+                template<typename FRI, typename ContainerType>
+                static void extend_to_domain(ContainerType &poly,
+                                             std::shared_ptr<math::evaluation_domain<typename FRI::field_type>> D) {
+                    // Resize uses low level thread pool, so we need to use the high level one here.
+                    parallel_for(0, poly.size(), [&poly, &D](std::size_t i) {
+                        if (poly[i].size() != D->size()) {
+                            poly[i].resize(D->size(), nullptr, D);
+                        }
+                    }, ThreadPool::PoolLevel::HIGH);
+                }
+
                 template<typename FRI,
                     typename std::enable_if<
                         std::is_base_of<
@@ -419,43 +500,7 @@ namespace nil {
                         throw std::runtime_error("Polynomial size does not match the domain size in FRI precommit.");
                     }
 
-                    std::size_t domain_size = D->size();
-                    std::size_t coset_size = 1 << fri_step;
-                    std::size_t leafs_number = domain_size / coset_size;
-                    std::vector<detail::fri_field_element_consumer<FRI>> y_data(
-                        leafs_number,
-                        detail::fri_field_element_consumer<FRI>(coset_size)
-                    );
-
-                    for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
-                        std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                        s_indices[0][0] = x_index;
-                        s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                        auto& element_consumer = y_data[x_index].reset_cursor();
-                        element_consumer.consume(f[s_indices[0][0]]);
-                        element_consumer.consume(f[s_indices[0][1]]);
-
-                        std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                        std::size_t prev_half_size = 1;
-                        std::size_t i = 1;
-                        while (i < coset_size / FRI::m) {
-                            for (std::size_t j = 0; j < prev_half_size; j++) {
-                                s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-
-                                element_consumer.consume(f[s_indices[i][0]]);
-                                element_consumer.consume(f[s_indices[i][1]]);
-
-                                i++;
-                            }
-                            base_index /= FRI::m;
-                            prev_half_size <<= 1;
-                        }
-                    }
-
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                    return precommit_cosets<FRI>(&f, 1, D->size(), fri_step);
                 }
 
                 template<typename FRI,
@@ -502,52 +547,8 @@ namespace nil {
                 ) {
                     PROFILE_SCOPE("Basic FRI Precommit time");
 
-                    // Resize uses low level thread pool, so we need to use the high level one here.
-                    parallel_for(0, poly.size(), [&poly, &D](std::size_t i) {
-                        if (poly[i].size() != D->size()) {
-                            poly[i].resize(D->size(), nullptr, D);
-                        }
-                    }, ThreadPool::PoolLevel::HIGH);
-
-                    std::size_t domain_size = D->size();
-                    std::size_t list_size = poly.size();
-                    std::size_t coset_size = 1 << fri_step;
-                    std::size_t leafs_number = domain_size / coset_size;
-                    std::vector<detail::fri_field_element_consumer<FRI>> y_data(
-                        leafs_number,
-                        detail::fri_field_element_consumer<FRI>(coset_size * list_size)
-                    );
-
-                    parallel_for(0, leafs_number, [&y_data, &poly, domain_size, coset_size, list_size](std::size_t x_index) {
-                        auto& element_consumer = y_data[x_index].reset_cursor();
-                        for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
-                            std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                            s_indices[0][0] = x_index;
-                            s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                            element_consumer.consume(poly[polynom_index][s_indices[0][0]]);
-                            element_consumer.consume(poly[polynom_index][s_indices[0][1]]);
-
-                            std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                            std::size_t prev_half_size = 1;
-                            std::size_t i = 1;
-                            while (i < coset_size / FRI::m) {
-                                for (std::size_t j = 0; j < prev_half_size; j++) {
-                                    s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                    s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][0]]);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][1]]);
-
-                                    i++;
-                                }
-                                base_index /= FRI::m;
-                                prev_half_size <<= 1;
-                            }
-                        }
-                    });
-
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                    extend_to_domain<FRI>(poly, D);
+                    return precommit_cosets<FRI>(poly.data(), poly.size(), D->size(), fri_step);
                 }
 
                 template<typename FRI, typename ContainerType,
@@ -738,35 +739,42 @@ namespace nil {
                     auto precommitment = combined_Q_precommitment;
                     std::size_t t = 0;
 
+                    constexpr bool is_dfs = std::is_same<
+                        math::polynomial_dfs<typename FRI::field_type::value_type>, PolynomialType>::value;
+                    // Inverse powers of the generator of D[0], shared by the folds on all the domains.
+                    std::vector<typename FRI::field_type::value_type> inv_twiddles;
+                    if constexpr (is_dfs) {
+                        inv_twiddles = commitments::detail::fold_inverse_twiddles<typename FRI::field_type>(
+                            fri_params.D[0]);
+                    }
+
                     for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
                         fs.push_back(f);
                         fri_trees.push_back(precommitment);
                         commitments_proof.fri_roots.push_back(commit<FRI>(precommitment));
                         transcript(commit<FRI>(precommitment));
-                        for (std::size_t step_i = 0; step_i < fri_params.step_list[i]; ++step_i, ++t) {
-                            typename FRI::field_type::value_type alpha = transcript.template challenge<typename FRI::field_type>();
-                            // Calculate next f
-                            if constexpr (std::is_same<math::polynomial_dfs<typename FRI::field_type::value_type>,
-                                    PolynomialType>::value) {
-                                f = commitments::detail::fold_polynomial<typename FRI::field_type>(f, alpha,
-                                                                                                   fri_params.D[t]);
-                            } else {
+                        // Nothing is added to the transcript between the rounds of one step, so all of its
+                        // challenges are known before folding.
+                        std::vector<typename FRI::field_type::value_type> alphas;
+                        for (std::size_t step_i = 0; step_i < fri_params.step_list[i]; ++step_i) {
+                            alphas.push_back(transcript.template challenge<typename FRI::field_type>());
+                        }
+                        // Calculate next f
+                        if constexpr (is_dfs) {
+                            f = commitments::detail::fold_polynomial_rounds<typename FRI::field_type>(
+                                f, alphas, inv_twiddles, fri_params.D[0]->size() / fri_params.D[t]->size());
+                        } else {
+                            for (const auto &alpha : alphas) {
                                 f = commitments::detail::fold_polynomial<typename FRI::field_type>(f, alpha);
                             }
                         }
+                        t += fri_params.step_list[i];
                         if (i != fri_params.step_list.size() - 1) {
-                            const auto& D = fri_params.D[t];
-                            if constexpr (std::is_same<math::polynomial_dfs<typename FRI::field_type::value_type>,
-                                    PolynomialType>::value) {
-                                if (f.size() != D->size()) {
-                                    f.resize(D->size(), nullptr, D);
-                                }
-                            }
-                            precommitment = precommit<FRI>(f, D, fri_params.step_list[i + 1]);
+                            precommitment = precommit<FRI>(f, fri_params.D[t], fri_params.step_list[i + 1]);
                         }
                     }
                     fs.push_back(f);
-                    if constexpr (std::is_same<math::polynomial_dfs<typename FRI::field_type::value_type>, PolynomialType>::value) {
+                    if constexpr (is_dfs) {
                         commitments_proof.final_polynomial = math::polynomial<typename FRI::field_type::value_type>(f.coefficients());
                     } else {
                         commitments_proof.final_polynomial = f;
@@ -782,7 +790,8 @@ namespace nil {
                     std::vector<math::polynomial<typename FRI::field_type::value_type>>
                 >  convert_polynomials_to_coefficients(
                     const typename FRI::params_type &fri_params,
-                    const std::map<std::size_t, std::vector<PolynomialType>> &g)
+                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
+                    const std::map<std::size_t, typename commitments::lde_store<PolynomialType>::rows_type> &opened_values = {})
                 {
                     std::map<
                         std::size_t,
@@ -800,6 +809,9 @@ namespace nil {
                         std::vector<std::pair<std::size_t, std::size_t>> key_index_pairs;
 
                         for (const auto &[key, poly_vector]: g) {
+                            // Values of the batches kept on D[0] are already read at the queried rows.
+                            if (opened_values.find(key) != opened_values.end())
+                                continue;
                             g_coeffs[key].resize(poly_vector.size());
 
                             for (std::size_t poly_index = 0; poly_index < poly_vector.size(); ++poly_index) {
@@ -841,7 +853,9 @@ namespace nil {
                         std::size_t,
                         std::vector<math::polynomial<typename FRI::field_type::value_type>>
                     > &g_coeffs,
-                    std::uint64_t x_index)
+                    std::uint64_t x_index,
+                    const std::map<std::size_t, typename commitments::lde_store<PolynomialType>::rows_type> &opened_values = {},
+                    const std::vector<std::size_t> &opened_rows = {})
                 {
                     std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
                     std::vector<std::array<std::size_t, FRI::m>> s_indices;
@@ -860,8 +874,24 @@ namespace nil {
                         // Fill values
                         const auto& g_k = it.second; // g[k]
 
+                        // Batches kept on D[0] have their values read at the queried rows.
+                        auto opened_it = opened_values.find(k);
+                        auto row_position = [&opened_rows](std::size_t row) {
+                            return std::lower_bound(opened_rows.begin(), opened_rows.end(), row) - opened_rows.begin();
+                        };
+
                         for (std::size_t polynomial_index = 0; polynomial_index < g_k.size(); ++polynomial_index) {
                             initial_proof[k].values[polynomial_index].resize(coset_size / FRI::m);
+                            if (opened_it != opened_values.end()) {
+                                const auto &values = opened_it->second[polynomial_index];
+                                for (std::size_t j = 0; j < coset_size / FRI::m; j++) {
+                                    std::size_t ind0 = std::min(s_indices[j][0], s_indices[j][1]);
+                                    std::size_t ind1 = std::max(s_indices[j][0], s_indices[j][1]);
+                                    initial_proof[k].values[polynomial_index][j][0] = values[row_position(ind0)];
+                                    initial_proof[k].values[polynomial_index][j][1] = values[row_position(ind1)];
+                                }
+                                continue;
+                            }
                             if constexpr (std::is_same<
                                     math::polynomial_dfs<typename FRI::field_type::value_type>,
                                     PolynomialType>::value
@@ -1027,7 +1057,8 @@ namespace nil {
                     const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
                     const typename FRI::params_type &fri_params,
                     const std::map<std::size_t, std::vector<PolynomialType>> &g,
-                    const std::vector<typename FRI::field_type::value_type>& challenges)
+                    const std::vector<typename FRI::field_type::value_type>& challenges,
+                    const commitments::lde_store<PolynomialType> *lde_values = nullptr)
                 {
                     typename FRI::initial_proofs_batch_type proof;
                     proof.initial_proofs.resize(fri_params.lambda);
@@ -1036,12 +1067,8 @@ namespace nil {
                     // and compute their values in those 2 * FRI::lambda points each, which is normally 2 * 20.
                     // In case lambda becomes much larger than log(2, average polynomial size), then this will not be optimal.
                     // For lambda = 20 and 2^20 rows in assignment table, it's faster and uses less RAM.
-                    std::map<std::size_t, std::vector<math::polynomial<typename FRI::field_type::value_type>>> g_coeffs =
-                        convert_polynomials_to_coefficients<FRI, PolynomialType>(fri_params, g);
-
-                    parallel_for(0, fri_params.lambda,
-                        [&proof, &fri_params, &precommitments, &g_coeffs, &g, &challenges](std::size_t query_id) {
-
+                    std::vector<std::uint64_t> x_indices(fri_params.lambda);
+                    parallel_for(0, fri_params.lambda, [&fri_params, &challenges, &x_indices](std::size_t query_id) {
                         std::size_t domain_size = fri_params.D[0]->size();
                         typename FRI::field_type::value_type x = challenges[query_id];
                         x = x.pow((FRI::field_type::modulus - 1) / domain_size);
@@ -1051,11 +1078,39 @@ namespace nil {
                         while (fri_params.D[0]->get_domain_element(x_index) != x) {
                             ++x_index;
                         }
+                        x_indices[query_id] = x_index;
+                    }, ThreadPool::PoolLevel::HIGH);
 
+                    // The batches kept on D[0] are read only at the queried rows, one batch at a time, so a spilled
+                    // batch is never loaded as a whole.
+                    std::vector<std::size_t> opened_rows;
+                    std::map<std::size_t, typename commitments::lde_store<PolynomialType>::rows_type> opened_values;
+                    if (lde_values != nullptr) {
+                        for (std::uint64_t x_index : x_indices) {
+                            auto s_indices = std::get<1>(calculate_s<FRI>(x_index, fri_params.step_list[0], fri_params.D[0]));
+                            for (auto const &indices : s_indices) {
+                                opened_rows.insert(opened_rows.end(), indices.begin(), indices.end());
+                            }
+                        }
+                        std::sort(opened_rows.begin(), opened_rows.end());
+                        opened_rows.erase(std::unique(opened_rows.begin(), opened_rows.end()), opened_rows.end());
+
+                        for (auto const &[k, polys] : g) {
+                            if (lde_values->contains(k)) {
+                                opened_values[k] = lde_values->get_rows(k, opened_rows);
+                            }
+                        }
+                    }
+
+                    std::map<std::size_t, std::vector<math::polynomial<typename FRI::field_type::value_type>>> g_coeffs =
+                        convert_polynomials_to_coefficients<FRI, PolynomialType>(fri_params, g, opened_values);
+
+                    parallel_for(0, fri_params.lambda,
+                        [&proof, &fri_params, &precommitments, &g_coeffs, &g, &x_indices, &opened_values, &opened_rows](std::size_t query_id) {
                         std::map<std::size_t, typename FRI::initial_proof_type>
                             initial_proof = build_initial_proof<FRI, PolynomialType>(
                                     precommitments,
-                                    fri_params, g, g_coeffs, x_index);
+                                    fri_params, g, g_coeffs, x_indices[query_id], opened_values, opened_rows);
                         proof.initial_proofs[query_id] = std::move(initial_proof);
                     }, ThreadPool::PoolLevel::HIGH);
 
@@ -1071,11 +1126,12 @@ namespace nil {
                     const std::map<std::size_t, std::vector<PolynomialType>> &g,
                     const std::vector<typename FRI::precommitment_type> &fri_trees,
                     const std::vector<PolynomialType> &fs,
-                    const math::polynomial<typename FRI::field_type::value_type> &final_polynomial)
+                    const math::polynomial<typename FRI::field_type::value_type> &final_polynomial,
+                    const commitments::lde_store<PolynomialType> *lde_values = nullptr)
                 {
                     typename FRI::initial_proofs_batch_type initial_proofs =
                         query_phase_initial_proofs<FRI, PolynomialType>(
-                            precommitments, fri_params, g, challenges);
+                            precommitments, fri_params, g, challenges, lde_values);
 
                     typename FRI::round_proofs_batch_type round_proofs =
                         query_phase_round_proofs<FRI, PolynomialType>(
@@ -1100,14 +1156,15 @@ namespace nil {
                     const std::map<std::size_t, std::vector<PolynomialType>> &g,
                     const std::vector<typename FRI::precommitment_type> &fri_trees,
                     const std::vector<PolynomialType> &fs,
-                    const math::polynomial<typename FRI::field_type::value_type> &final_polynomial)
+                    const math::polynomial<typename FRI::field_type::value_type> &final_polynomial,
+                    const commitments::lde_store<PolynomialType> *lde_values = nullptr)
                 {
                     PROFILE_SCOPE("Basic FRI query phase");
                     std::vector<typename FRI::field_type::value_type> challenges =
                         transcript.template challenges<typename FRI::field_type>(fri_params.lambda);
 
                     return query_phase_with_challenges<FRI, PolynomialType>(
-                        precommitments, fri_params, challenges, g, fri_trees, fs, final_polynomial);
+                        precommitments, fri_params, challenges, g, fri_trees, fs, final_polynomial, lde_values);
                 }
 
                 template<typename FRI,
@@ -1125,7 +1182,12 @@ namespace nil {
 
                     if (fri_params.use_grinding) {
                         PROFILE_SCOPE("Basic FRI grinding phase");
-                        return FRI::grinding_type::generate(transcript, fri_params.grinding_parameter);
+                        commitments::detail::grinding_statistics stats;
+                        auto result = FRI::grinding_type::generate(transcript, fri_params.grinding_parameter, &stats);
+                        BOOST_LOG_TRIVIAL(debug) << "Grinding " << fri_params.grinding_parameter << " bits: "
+                                                 << stats.hashes << " hashes in " << stats.seconds << " s, "
+                                                 << stats.hashes_per_second() << " hashes/s";
+                        return result;
                     }
                     return typename FRI::grinding_type::output_type();
                 }
@@ -1145,7 +1207,8 @@ namespace nil {
                     const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
                     const typename FRI::precommitment_type &combined_Q_precommitment,
                     const typename FRI::params_type &fri_params,
-                    typename FRI::transcript_type &transcript
+                    typename FRI::transcript_type &transcript,
+                    const commitments::lde_store<PolynomialType> *lde_values = nullptr
                 ) {
                     PROFILE_SCOPE("Basic FRI proof_eval time");
                     typename FRI::proof_type proof;
@@ -1174,7 +1237,7 @@ namespace nil {
                     // Query phase
                     proof.query_proofs = query_phase<FRI, PolynomialType>(
                         precommitments, fri_params, transcript,
-                        g, fri_trees, fs, commitments_proof.final_polynomial);
+                        g, fri_trees, fs, commitments_proof.final_polynomial, lde_values);
 
                     proof.fri_roots = std::move(commitments_proof.fri_roots);
                     proof.final_polynomial = std::move(commitments_proof.final_polynomial);
@@ -27,6 +27,10 @@
 #ifndef CRYPTO3_ZK_COMMITMENTS_DETAIL_FOLD_POLYNOMIAL_HPP
 #define CRYPTO3_ZK_COMMITMENTS_DETAIL_FOLD_POLYNOMIAL_HPP
 
+#include <vector>
+
+#include <boost/assert.hpp>
+
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
@@ -40,6 +44,9 @@
 
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace zk {
@@ -91,6 +98,91 @@ namespace nil {
 
                         return f_folded;
                     }
+
+                    /**
+                     * Returns omega^-i for i < domain->size() / 2, where omega is the generator of 'domain'.
+                     * The table of the first FRI domain serves all the later ones, their generators are the powers
+                     * omega^(2^t), see fold_polynomial_rounds.
+                     */
+                    template<typename FieldType>
+                    std::vector<typename FieldType::value_type> fold_inverse_twiddles(
+                            std::shared_ptr<math::evaluation_domain<FieldType>> domain) {
+                        typedef typename FieldType::value_type value_type;
+
+                        std::vector<value_type> inv_twiddles(domain->size() / 2);
+                        const value_type omega_inversed = domain->get_domain_element(domain->size() - 1);
+                        parallel_for_chunks(
+                            inv_twiddles.size(),
+                            [&inv_twiddles, &omega_inversed](std::size_t begin, std::size_t end) {
+                                value_type acc = omega_inversed.pow(begin);
+                                for (std::size_t i = begin; i < end; ++i, acc *= omega_inversed) {
+                                    inv_twiddles[i] = acc;
+                                }
+                            },
+                            ThreadPool::PoolLevel::LOW);
+                        return inv_twiddles;
+                    }
+
+                    /**
+                     * Folds the codeword 'f' alphas.size() times, the same as calling fold_polynomial with every
+                     * challenge in turn on the halved domains, but in a single pass over f.
+                     * An output value at index i depends only on the input values at i + j * (f.size() / 2^k) for
+                     * j < 2^k, where k is alphas.size(), so each of them is computed independently from its coset,
+                     * and the work is split into chunks which run in parallel. The powers of omega^-1 are taken
+                     * from 'inv_twiddles', which is fold_inverse_twiddles of a domain of size f.size() * stride.
+                     */
+                    template<typename FieldType>
+                    math::polynomial_dfs<typename FieldType::value_type>
+                    fold_polynomial_rounds(const math::polynomial_dfs<typename FieldType::value_type> &f,
+                                           const std::vector<typename FieldType::value_type> &alphas,
+                                           const std::vector<typename FieldType::value_type> &inv_twiddles,
+                                           std::size_t stride = 1) {
+                        typedef typename FieldType::value_type value_type;
+
+                        const std::size_t rounds = alphas.size();
+                        const std::size_t coset_size = std::size_t(1) << rounds;
+                        const std::size_t folded_size = f.size() / coset_size;
+                        BOOST_ASSERT(folded_size * coset_size == f.size());
+                        BOOST_ASSERT(f.size() * stride / 2 == inv_twiddles.size());
+
+                        math::polynomial_dfs<value_type> f_folded(folded_size - 1, folded_size, value_type::zero());
+
+                        // Every round halves the value, so it is scaled by 2^-rounds once at the end.
+                        value_type scale = value_type::one();
+                        const value_type two_inversed = value_type(2u).inversed();
+                        for (std::size_t s = 0; s < rounds; ++s) {
+                            scale *= two_inversed;
+                        }
+
+                        parallel_for_chunks(
+                            folded_size,
+                            [&f, &f_folded, &alphas, &inv_twiddles, &scale, rounds, coset_size, folded_size,
+                             stride](std::size_t begin, std::size_t end) {
+                                std::vector<value_type> coset(coset_size);
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    for (std::size_t j = 0; j < coset_size; ++j) {
+                                        coset[j] = f[i + j * folded_size];
+                                    }
+                                    // coset[j] holds the value at i + j * folded_size of the current round's domain,
+                                    // its second half are the values at the opposite points.
+                                    std::size_t half = coset_size / 2;
+                                    std::size_t twiddle_step = stride;
+                                    for (std::size_t s = 0; s < rounds; ++s, half /= 2, twiddle_step *= 2) {
+                                        for (std::size_t j = 0; j < half; ++j) {
+                                            const value_type &x_inversed =
+                                                inv_twiddles[(i + j * folded_size) * twiddle_step];
+                                            value_type sum = coset[j] + coset[j + half];
+                                            value_type difference = coset[j] - coset[j + half];
+                                            coset[j] = sum + alphas[s] * x_inversed * difference;
+                                        }
+                                    }
+                                    f_folded[i] = coset[0] * scale;
+                                }
+                            },
+                            ThreadPool::PoolLevel::LOW);
+
+                        return f_folded;
+                    }
                 }    // namespace detail
             }        // namespace commitments
         }            // namespace zk
@@ -0,0 +1,302 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_LDE_STORE_HPP
+#define CRYPTO3_ZK_COMMITMENTS_LDE_STORE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+
+                /**
+                 * Keeps the evaluations of the committed batches extended to the FRI domain D[0] by the precommit,
+                 * so the later stages of the proof read them instead of extending the same polynomials again.
+                 *
+                 * Batches are kept in memory while their total size fits into the memory limit. Batches which do
+                 * not fit are written to the spill directory if one is set, otherwise they are not kept and the
+                 * callers fall back to recomputing them. The store is disabled by default.
+                 *
+                 * Copies of the store share the kept batches and spill files, the files are removed with the last copy.
+                 */
+                template<typename PolynomialType>
+                class lde_store {
+                public:
+                    typedef PolynomialType polynomial_type;
+                    typedef typename polynomial_type::value_type value_type;
+                    typedef std::vector<polynomial_type> batch_type;
+                    typedef std::shared_ptr<const batch_type> batch_ptr_type;
+                    typedef std::vector<std::vector<value_type>> rows_type;
+
+                    struct statistics {
+                        std::size_t memory_bytes = 0;
+                        std::size_t batches_in_memory = 0;
+                        std::size_t batches_spilled = 0;
+                        std::size_t batches_dropped = 0;
+                    };
+
+                    // Values can be spilled as raw bytes only if they don't hold pointers.
+                    static constexpr bool can_spill = std::is_trivially_copyable<value_type>::value;
+
+                    void set_memory_limit(std::size_t bytes) {
+                        _memory_limit = bytes;
+                    }
+
+                    std::size_t get_memory_limit() const {
+                        return _memory_limit;
+                    }
+
+                    // Empty path disables spilling.
+                    void set_spill_directory(const std::string &path) {
+                        _spill_directory = path;
+                    }
+
+                    const std::string &get_spill_directory() const {
+                        return _spill_directory;
+                    }
+
+                    bool enabled() const {
+                        return _memory_limit > 0 || (can_spill && !_spill_directory.empty());
+                    }
+
+                    /**
+                     * Keeps the extended evaluations of batch 'batch_id', replacing the ones stored before.
+                     */
+                    void store(std::size_t batch_id, batch_type &&batch) {
+                        erase(batch_id);
+
+                        const std::size_t bytes = batch_bytes(batch);
+                        if (_stats.memory_bytes + bytes <= _memory_limit) {
+                            _in_memory[batch_id] = std::make_shared<const batch_type>(std::move(batch));
+                            _stats.memory_bytes += bytes;
+                            ++_stats.batches_in_memory;
+                            return;
+                        }
+
+                        if constexpr (can_spill) {
+                            if (!_spill_directory.empty()) {
+                                _spilled[batch_id] = spill(batch);
+                                ++_stats.batches_spilled;
+                                return;
+                            }
+                        }
+                        ++_stats.batches_dropped;
+                    }
+
+                    bool contains(std::size_t batch_id) const {
+                        return _in_memory.count(batch_id) != 0 || _spilled.count(batch_id) != 0;
+                    }
+
+                    /**
+                     * Returns the extended evaluations of batch 'batch_id', reading them back if they were spilled.
+                     * Returns nullptr if the batch is not kept.
+                     */
+                    batch_ptr_type get(std::size_t batch_id) const {
+                        auto it = _in_memory.find(batch_id);
+                        if (it != _in_memory.end()) {
+                            return it->second;
+                        }
+                        if constexpr (can_spill) {
+                            auto spilled_it = _spilled.find(batch_id);
+                            if (spilled_it != _spilled.end()) {
+                                return load(*spilled_it->second);
+                            }
+                        }
+                        return nullptr;
+                    }
+
+                    /**
+                     * Same as get, but returns nullptr for a spilled batch instead of loading it, for the callers
+                     * which would keep the whole batch in memory for long and can recompute it column by column.
+                     */
+                    batch_ptr_type get_in_memory(std::size_t batch_id) const {
+                        auto it = _in_memory.find(batch_id);
+                        return it != _in_memory.end() ? it->second : nullptr;
+                    }
+
+                    /**
+                     * Returns the values of the polynomials of batch 'batch_id' at the given rows of D[0], the result
+                     * [i][j] is the value of polynomial i at rows[j]. Only these values are read from a spill file.
+                     * Returns an empty vector if the batch is not kept.
+                     */
+                    rows_type get_rows(std::size_t batch_id, const std::vector<std::size_t> &rows) const {
+                        auto it = _in_memory.find(batch_id);
+                        if (it != _in_memory.end()) {
+                            rows_type result(it->second->size(), std::vector<value_type>(rows.size()));
+                            for (std::size_t i = 0; i < it->second->size(); ++i) {
+                                for (std::size_t j = 0; j < rows.size(); ++j) {
+                                    result[i][j] = (*it->second)[i][rows[j]];
+                                }
+                            }
+                            return result;
+                        }
+                        if constexpr (can_spill) {
+                            auto spilled_it = _spilled.find(batch_id);
+                            if (spilled_it != _spilled.end()) {
+                                return load_rows(*spilled_it->second, rows);
+                            }
+                        }
+                        return {};
+                    }
+
+                    void erase(std::size_t batch_id) {
+                        auto it = _in_memory.find(batch_id);
+                        if (it != _in_memory.end()) {
+                            _stats.memory_bytes -= batch_bytes(*it->second);
+                            --_stats.batches_in_memory;
+                            _in_memory.erase(it);
+                        }
+                        if (_spilled.erase(batch_id) != 0) {
+                            --_stats.batches_spilled;
+                        }
+                    }
+
+                    void clear() {
+                        _in_memory.clear();
+                        _spilled.clear();
+                        _stats = statistics();
+                    }
+
+                    const statistics &get_statistics() const {
+                        return _stats;
+                    }
+
+                private:
+                    // Removes the file when the last copy of the store referencing it is gone.
+                    struct spill_file {
+                        explicit spill_file(std::string path) : path(std::move(path)) {
+                        }
+
+                        spill_file(const spill_file &) = delete;
+                        spill_file &operator=(const spill_file &) = delete;
+
+                        ~spill_file() {
+                            std::remove(path.c_str());
+                        }
+
+                        std::string path;
+                    };
+
+                    static std::size_t batch_bytes(const batch_type &batch) {
+                        std::size_t bytes = 0;
+                        for (auto const &poly : batch) {
+                            bytes += poly.size() * sizeof(value_type);
+                        }
+                        return bytes;
+                    }
+
+                    std::string make_spill_path() const {
+                        // Several stores, also in different processes, may use the same directory.
+                        static const std::uint64_t process_tag = std::random_device()();
+                        static std::atomic<std::uint64_t> counter(0);
+                        return _spill_directory + "/lde_" + std::to_string(process_tag) + "_" +
+                               std::to_string(counter++) + ".bin";
+                    }
+
+                    // File layout: number of polynomials, then for every polynomial its degree, its size and
+                    // the raw values.
+                    std::shared_ptr<const spill_file> spill(const batch_type &batch) const {
+                        auto file = std::make_shared<const spill_file>(make_spill_path());
+                        std::ofstream out(file->path, std::ios::binary | std::ios::trunc);
+                        write_size(out, batch.size());
+                        for (auto const &poly : batch) {
+                            write_size(out, poly.degree());
+                            write_size(out, poly.size());
+                            out.write(reinterpret_cast<const char *>(poly.data()), poly.size() * sizeof(value_type));
+                        }
+                        if (!out) {
+                            throw std::runtime_error("Can't write LDE values to " + file->path);
+                        }
+                        return file;
+                    }
+
+                    static batch_ptr_type load(const spill_file &file) {
+                        std::ifstream in(file.path, std::ios::binary);
+                        auto batch = std::make_shared<batch_type>(read_size(in));
+                        for (auto &poly : *batch) {
+                            const std::size_t degree = read_size(in);
+                            poly = polynomial_type(degree, read_size(in));
+                            in.read(reinterpret_cast<char *>(poly.data()), poly.size() * sizeof(value_type));
+                        }
+                        if (!in) {
+                            throw std::runtime_error("Can't read LDE values from " + file.path);
+                        }
+                        return batch;
+                    }
+
+                    static rows_type load_rows(const spill_file &file, const std::vector<std::size_t> &rows) {
+                        std::ifstream in(file.path, std::ios::binary);
+                        rows_type result(read_size(in), std::vector<value_type>(rows.size()));
+                        for (auto &values : result) {
+                            read_size(in);
+                            const std::size_t size = read_size(in);
+                            const std::streamoff offset = in.tellg();
+                            for (std::size_t j = 0; j < rows.size(); ++j) {
+                                in.seekg(offset + static_cast<std::streamoff>(rows[j] * sizeof(value_type)));
+                                in.read(reinterpret_cast<char *>(&values[j]), sizeof(value_type));
+                            }
+                            in.seekg(offset + static_cast<std::streamoff>(size * sizeof(value_type)));
+                        }
+                        if (!in) {
+                            throw std::runtime_error("Can't read LDE values from " + file.path);
+                        }
+                        return result;
+                    }
+
+                    static void write_size(std::ofstream &out, std::size_t value) {
+                        const std::uint64_t size = value;
+                        out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+                    }
+
+                    static std::size_t read_size(std::ifstream &in) {
+                        std::uint64_t size = 0;
+                        in.read(reinterpret_cast<char *>(&size), sizeof(size));
+                        return size;
+                    }
+
+                    std::size_t _memory_limit = 0;
+                    std::string _spill_directory;
+                    std::map<std::size_t, batch_ptr_type> _in_memory;
+                    std::map<std::size_t, std::shared_ptr<const spill_file>> _spilled;
+                    statistics _stats;
+                };
+            }    // namespace commitments
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_LDE_STORE_HPP
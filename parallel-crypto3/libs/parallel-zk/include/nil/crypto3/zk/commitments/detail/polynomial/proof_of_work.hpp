@@ -27,7 +27,11 @@
 #define CRYPTO3_PROOF_OF_WORK_HPP
 
 #include <boost/property_tree/ptree.hpp>
+#include <boost/random/random_device.hpp>
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 
 #include <nil/crypto3/random/algebraic_engine.hpp>
@@ -41,6 +45,72 @@ namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace commitments {
+                namespace detail {
+                    struct grinding_statistics {
+                        std::size_t hashes = 0;
+                        double seconds = 0;
+
+                        double hashes_per_second() const {
+                            return seconds > 0 ? hashes / seconds : 0;
+                        }
+                    };
+
+                    /**
+                     * Calls check(i) for i = 0, Step, 2 * Step, ... on all the threads of the pool until it
+                     * returns a value below Step, and returns i plus that value. check(i) tries the offsets
+                     * i, ..., i + Step - 1 together and returns the position of a successful one among them, or
+                     * Step if there is none. Threads take the offsets in small batches from a shared counter and
+                     * look at the 'found' flag after every call, so nobody waits on a barrier, and all of them
+                     * stop right after the first success. The offset found is not necessarily the smallest one.
+                     */
+                    template<std::size_t Step, typename CheckFunction>
+                    std::size_t parallel_grind(const CheckFunction &check, grinding_statistics *stats = nullptr) {
+                        static constexpr std::size_t BATCH_SIZE = 1 << 10;
+                        static_assert(Step > 0 && BATCH_SIZE % Step == 0, "Batches must hold whole steps");
+
+                        const auto start = std::chrono::steady_clock::now();
+                        const std::size_t lanes =
+                            ThreadPool::get_instance(ThreadPool::PoolLevel::HIGH).get_pool_size();
+
+                        std::atomic<std::size_t> next_batch(0);
+                        std::atomic<bool> found(false);
+                        std::atomic<std::size_t> hashes(0);
+                        std::size_t result = 0;
+
+                        parallel_for_chunks(
+                            lanes,
+                            [&check, &next_batch, &found, &hashes, &result](std::size_t, std::size_t) {
+                                std::size_t done = 0;
+                                while (!found.load(std::memory_order_relaxed)) {
+                                    const std::size_t begin = next_batch.fetch_add(BATCH_SIZE, std::memory_order_relaxed);
+                                    for (std::size_t i = begin; i < begin + BATCH_SIZE; i += Step) {
+                                        if (found.load(std::memory_order_relaxed)) {
+                                            break;
+                                        }
+                                        done += Step;
+                                        const std::size_t position = check(i);
+                                        if (position < Step) {
+                                            bool expected = false;
+                                            if (found.compare_exchange_strong(expected, true)) {
+                                                result = i + position;
+                                            }
+                                            break;
+                                        }
+                                    }
+                                }
+                                hashes += done;
+                            },
+                            ThreadPool::PoolLevel::HIGH);
+
+                        if (stats != nullptr) {
+                            stats->hashes = hashes;
+                            stats->seconds =
+                                std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                        }
+                        return result;
+                    }
+                }    // namespace detail
+
                 template<typename TranscriptHashType, typename OutType = std::uint32_t>
                 class proof_of_work {
                 public:
@@ -48,6 +118,9 @@ namespace nil {
                     using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
                     using output_type = OutType;
 
+                    // Nonces hashed together by one grinding call, enough to fill the widest Keccak SIMD path.
+                    static constexpr std::size_t GRINDING_LANES = 8;
+
                     static inline std::array<std::uint8_t, sizeof(OutType)>
                         to_byte_array(OutType v) {
                             std::array<std::uint8_t, sizeof(OutType)> bytes;
@@ -58,49 +131,38 @@ namespace nil {
                             return bytes;
                         }
 
-                    static inline OutType generate(transcript_type &transcript, std::size_t grinding_bits = 16) {
+                    static inline OutType generate(transcript_type &transcript, std::size_t grinding_bits = 16,
+                                                   detail::grinding_statistics *stats = nullptr) {
                         BOOST_ASSERT_MSG(grinding_bits < 64, "Grinding parameter should be bits, not mask");
                         output_type mask = grinding_bits > 0 ? ( 1ULL << grinding_bits ) - 1 : 0;
-                        output_type pow_seed = std::rand();
 
-                        /* Enough work for ~ two minutes on 48 cores, keccak<512> */
-                        std::size_t per_block = 1 << 30;
+                        static boost::random::random_device dev;
+                        const output_type pow_seed = static_cast<output_type>(dev());
 
-                        std::atomic<bool> challenge_found = false;
-                        std::atomic<std::size_t> pow_value_offset;
+                        // The transcript is only read while grinding, so all the threads share it.
+                        const transcript_type &grinding_transcript = transcript;
 
-                        while( true ) {
-                            wait_for_all(parallel_run_in_chunks<void>(
-                                per_block,
-                                [&transcript, &pow_seed, &challenge_found, &pow_value_offset, &mask](std::size_t pow_start, std::size_t pow_finish) {
-                                    std::size_t i = pow_start;
-                                    while ( i < pow_finish ) {
-                                        if (challenge_found) {
-                                            break;
-                                        }
-                                        transcript_type tmp_transcript = transcript;
-                                        tmp_transcript(to_byte_array(pow_seed + i));
-                                        OutType pow_result = tmp_transcript.template int_challenge<OutType>();
-                                        if ( ((pow_result & mask) == 0) && !challenge_found ) {
-                                            bool expected = false;
-                                            if (challenge_found.compare_exchange_strong(expected, true)) {
-                                                pow_value_offset = i;
-                                            }
-                                            break;
+                        const output_type pow_value =
+                            pow_seed + static_cast<output_type>(detail::parallel_grind<GRINDING_LANES>(
+                                [&grinding_transcript, &pow_seed, &mask](std::size_t first) {
+                                    std::array<std::array<std::uint8_t, sizeof(OutType)>, GRINDING_LANES> nonces;
+                                    for (std::size_t lane = 0; lane < GRINDING_LANES; ++lane) {
+                                        nonces[lane] = to_byte_array(pow_seed + static_cast<output_type>(first + lane));
+                                    }
+                                    const std::array<OutType, GRINDING_LANES> pow_results =
+                                        grinding_transcript.template int_challenges_batch<OutType>(nonces);
+                                    for (std::size_t lane = 0; lane < GRINDING_LANES; ++lane) {
+                                        if ((pow_results[lane] & mask) == 0) {
+                                            return lane;
                                         }
-                                        ++i;
                                     }
-                                }, ThreadPool::PoolLevel::LOW));
+                                    return GRINDING_LANES;
+                                },
+                                stats));
 
-                            if (challenge_found) {
-                                break;
-                            }
-                            pow_seed += per_block;
-                        }
-
-                        transcript(to_byte_array(pow_seed + (std::size_t)pow_value_offset));
+                        transcript(to_byte_array(pow_value));
                         transcript.template int_challenge<OutType>();
-                        return pow_seed + (std::size_t)pow_value_offset;
+                        return pow_value;
                     }
 
                     static inline bool verify(transcript_type &transcript, output_type proof_of_work, std::size_t grinding_bits = 16) {
@@ -124,54 +186,31 @@ namespace nil {
                     using value_type = typename FieldType::value_type;
                     using integral_type = typename FieldType::integral_type;
 
-                    static inline value_type generate(transcript_type &transcript, std::size_t GrindingBits=16) {
+                    static inline value_type generate(transcript_type &transcript, std::size_t GrindingBits=16,
+                                                      detail::grinding_statistics *stats = nullptr) {
                         static boost::random::random_device dev;
                         static nil::crypto3::random::algebraic_engine<FieldType> random_engine(dev);
-                        value_type pow_seed = random_engine();
+                        const value_type pow_seed = random_engine();
 
                         integral_type mask =
                             (GrindingBits > 0 ?
                                 ((integral_type(1) << GrindingBits) - 1) << (FieldType::modulus_bits - GrindingBits)
                                 : 0);
 
-                        /* Enough work for ~ two minutes on 48 cores, poseidon<pallas> */
-                        std::size_t per_block = 1 << 23;
-
-                        std::atomic<bool> challenge_found = false;
-                        std::atomic<std::size_t> pow_value_offset;
+                        const typename transcript_type::midstate_type midstate = transcript.midstate();
 
-                        while( true ) {
-                            wait_for_all(parallel_run_in_chunks<void>(
-                                per_block,
-                                [&transcript, &pow_seed, &challenge_found, &pow_value_offset, &mask](std::size_t pow_start, std::size_t pow_finish) {
-                                    std::size_t i = pow_start;
-                                    while ( i < pow_finish ) {
-                                        if (challenge_found) {
-                                            break;
-                                        }
-                                        transcript_type tmp_transcript = transcript;
-                                        tmp_transcript(pow_seed + i);
-                                        integral_type pow_result = integral_type(tmp_transcript.template challenge<FieldType>().data);
-                                        if ( ((pow_result & mask) == 0) && !challenge_found ) {
-                                            bool expected = false;
-                                            if (challenge_found.compare_exchange_strong(expected, true)) {
-                                                pow_value_offset = i;
-                                            }
-                                            break;
-                                        }
-                                        ++i;
-                                    }
-                                }, ThreadPool::PoolLevel::LOW));
-
-                            if (challenge_found) {
-                                break;
-                            }
-                            pow_seed += per_block;
-                        }
+                        const value_type pow_value = pow_seed + detail::parallel_grind<1>(
+                            [&midstate, &pow_seed, &mask](std::size_t i) -> std::size_t {
+                                integral_type pow_result = integral_type(
+                                    transcript_type::template challenge_from_midstate<FieldType>(
+                                        midstate, value_type(pow_seed + i)).data);
+                                return (pow_result & mask) == 0 ? 0 : 1;
+                            },
+                            stats);
 
-                        transcript(pow_seed + (std::size_t)pow_value_offset);
+                        transcript(pow_value);
                         transcript.template challenge<FieldType>();
-                        return pow_seed + (std::size_t)pow_value_offset;
+                        return pow_value;
                     }
 
                     static inline bool verify(transcript_type &transcript, value_type proof_of_work, std::size_t GrindingBits=16) {
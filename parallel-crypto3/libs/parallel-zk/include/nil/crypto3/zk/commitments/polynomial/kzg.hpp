@@ -44,6 +44,7 @@
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/math/algorithms/parallel_multiexp.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
 #include <nil/crypto3/hash/block_to_field_elements_wrapper.hpp>
 
@@ -76,7 +77,7 @@ namespace nil {
                     typedef CurveType curve_type;
                     typedef typename curve_type::gt_type::value_type gt_value_type;
 
-                    using multiexp_method = typename algebra::policies::multiexp_method_BDLO12;
+                    using multiexp_method = typename algebra::policies::multiexp_method_parallel_pippenger;
                     using field_type = typename curve_type::scalar_field_type;
                     using scalar_value_type = typename curve_type::scalar_field_type::value_type;
                     using single_commitment_type = std::vector<typename curve_type::template g1_type<>::value_type>;
@@ -243,7 +244,7 @@ namespace nil {
                     typedef TranscriptHashType transcript_hash_type;
                     typedef typename curve_type::gt_type::value_type gt_value_type;
 
-                    using multiexp_method = typename algebra::policies::multiexp_method_BDLO12;
+                    using multiexp_method = typename algebra::policies::multiexp_method_parallel_pippenger;
                     using field_type = typename curve_type::scalar_field_type;
                     using scalar_value_type = typename curve_type::scalar_field_type::value_type;
                     using single_commitment_type = typename curve_type::template g1_type<>::value_type;
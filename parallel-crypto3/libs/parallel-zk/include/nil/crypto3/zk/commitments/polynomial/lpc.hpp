@@ -30,6 +30,8 @@
 #ifndef CRYPTO3_ZK_LIST_POLYNOMIAL_COMMITMENT_SCHEME_HPP
 #define CRYPTO3_ZK_LIST_POLYNOMIAL_COMMITMENT_SCHEME_HPP
 
+#include <nil/crypto3/algebra/fields/detail/element/accumulator.hpp>
+#include <nil/crypto3/math/algorithms/batch_inversion.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
 
@@ -38,6 +40,7 @@
 
 #include <nil/crypto3/zk/commitments/batched_commitment.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/basic_fri.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/lde_store.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
 #include <nil/actor/core/parallelization_utils.hpp>
@@ -75,6 +78,7 @@ namespace nil {
                     using preprocessed_data_type = std::map<std::size_t, std::vector<value_type>>;
                     using polys_evaluator_type = polys_evaluator<typename LPCScheme::params_type,
                         typename LPCScheme::commitment_type, PolynomialType>;
+                    using lde_store_type = lde_store<PolynomialType>;
 
                 private:
                     std::map<std::size_t, precommitment_type> _trees;
@@ -82,6 +86,8 @@ namespace nil {
                     value_type _etha;
                     std::map<std::size_t, bool> _batch_fixed;
                     preprocessed_data_type _fixed_polys_values;
+                    // Evaluations of the committed batches on D[0], not a part of the scheme state.
+                    lde_store_type _lde_store;
 
                 public:
                     // Getters for the upper fields. Used from marshalling only so far.
@@ -94,6 +100,10 @@ namespace nil {
                     // We must set it in verifier, taking this value from common data.
                     void set_fixed_polys_values(const preprocessed_data_type& value) {_fixed_polys_values = value;}
 
+                    // Disabled by default, set its memory limit or spill directory to keep the LDEs of the batches.
+                    lde_store_type& get_lde_store() {return _lde_store;}
+                    const lde_store_type& get_lde_store() const {return _lde_store;}
+
                     // This constructor is normally used from marshalling, to recover the LPC state from a file.
                     // Maybe we want the move variant of this constructor.
                     lpc_commitment_scheme(
@@ -140,6 +150,35 @@ namespace nil {
                     commitment_type commit(std::size_t index) {
                         this->state_commited(index);
 
+                        if constexpr(std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value) {
+                            if (_lde_store.enabled()) {
+                                // Same as precommit, but the extended polynomials are kept for the later stages.
+                                // The batch is extended in place, the values on the original domains are then
+                                // taken back from D[0], where they are every (|D[0]| / size)-th value.
+                                std::vector<polynomial_type> extended = std::move(this->_polys[index]);
+                                std::vector<std::size_t> sizes(extended.size());
+                                for (std::size_t i = 0; i < extended.size(); ++i) {
+                                    sizes[i] = extended[i].size();
+                                }
+                                nil::crypto3::zk::algorithms::extend_to_domain<fri_type>(extended, _fri_params.D[0]);
+                                _trees[index] = nil::crypto3::zk::algorithms::precommit_cosets<fri_type>(
+                                    extended.data(), extended.size(), _fri_params.D[0]->size(),
+                                    _fri_params.step_list.front());
+
+                                std::vector<polynomial_type> &polys = this->_polys[index];
+                                polys.resize(extended.size());
+                                parallel_for(0, extended.size(), [&polys, &extended, &sizes](std::size_t i) {
+                                    const std::size_t stride = extended[i].size() / sizes[i];
+                                    polys[i] = polynomial_type(extended[i].degree(), sizes[i]);
+                                    for (std::size_t k = 0; k < sizes[i]; ++k) {
+                                        polys[i][k] = extended[i][k * stride];
+                                    }
+                                }, ThreadPool::PoolLevel::HIGH);
+                                _lde_store.store(index, std::move(extended));
+                                return _trees[index].root();
+                            }
+                        }
+
                         _trees[index] = nil::crypto3::zk::algorithms::precommit<fri_type>(
                             this->_polys[index], _fri_params.D[0], _fri_params.step_list.front());
                         return _trees[index].root();
@@ -187,7 +226,7 @@ namespace nil {
 
                         typename fri_type::initial_proofs_batch_type initial_proofs =
                             nil::crypto3::zk::algorithms::query_phase_initial_proofs<fri_type, polynomial_type>(
-                            this->_trees, this->_fri_params, this->_polys, challenges);
+                            this->_trees, this->_fri_params, this->_polys, challenges, &_lde_store);
                         return {this->_z, initial_proofs};
                     }
 
@@ -261,7 +300,8 @@ namespace nil {
                             this->_trees,
                             combined_Q_precommitment,
                             this->_fri_params,
-                            transcript
+                            transcript,
+                            &_lde_store
                         );
                         return fri_proof;
                     }
@@ -276,6 +316,131 @@ namespace nil {
                     polynomial_type prepare_combined_Q(
                             const typename field_type::value_type& theta,
                             std::size_t starting_power = 0) {
+                        if constexpr(std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value) {
+                            this->build_points_map();
+                            if (!has_eval_point_in_lde_domain()) {
+                                return prepare_combined_Q_dfs(theta, starting_power);
+                            }
+                        }
+                        return prepare_combined_Q_coefficients(theta, starting_power);
+                    }
+
+                    /** \brief Same as 'prepare_combined_Q', but without leaving the evaluation form.
+                     *  The polynomials opened at the same point are summed with their powers of theta on their own
+                     *  domains, so every numerator is extended to D[0] only once. If the batches of a numerator are
+                     *  kept in the LDE store and it is cheaper, the numerator is summed on D[0] from the kept values
+                     *  instead. Then the numerators are divided by (x - point) on D[0] with batch inverted denominators.
+                     *  No polynomial is converted to coefficients. The evaluation points must not belong to D[0].
+                     */
+                    polynomial_type prepare_combined_Q_dfs(
+                            const typename field_type::value_type& theta,
+                            std::size_t starting_power = 0) {
+                        PROFILE_SCOPE("Combined Q in evaluation form");
+                        this->build_points_map();
+
+                        // Terms theta^k * (f_k(x) - z_k) of one numerator.
+                        struct numerator_term {
+                            const polynomial_type *poly;
+                            value_type theta_power;
+                            value_type value;
+                            std::size_t batch;
+                            std::size_t index;
+                        };
+                        std::vector<value_type> points = this->get_unique_points();
+                        std::vector<std::vector<numerator_term>> terms(points.size());
+
+                        // Powers of theta are taken in the same order as in 'prepare_combined_Q_coefficients'.
+                        value_type theta_acc = theta.pow(starting_power);
+                        std::size_t current_power = starting_power;
+                        for (std::size_t point_index = 0; point_index < points.size(); ++point_index) {
+                            for (std::size_t i : this->_z.get_batches()) {
+                                for (std::size_t j = 0; j < this->_z.get_batch_size(i); j++) {
+                                    auto iter = this->_points_map[i][j].find(points[point_index]);
+                                    if (iter == this->_points_map[i][j].end())
+                                        continue;
+                                    terms[point_index].push_back(
+                                        {&this->_polys[i][j], theta_acc, this->_z.get(i, j, iter->second), i, j});
+                                    theta_acc *= theta;
+                                    current_power++;
+                                }
+                            }
+                        }
+
+                        // Fixed batches are opened at _etha, their power of theta is indexed by the batch id.
+                        std::vector<std::size_t> theta_powers = {current_power};
+                        for (std::size_t i : this->_z.get_batches()) {
+                            theta_powers.push_back(theta_powers.back() + this->_z.get_batch_size(i));
+                        }
+                        std::vector<numerator_term> etha_terms;
+                        for (std::size_t i : this->_z.get_batches()) {
+                            if (_batch_fixed.find(i) == _batch_fixed.end() || !_batch_fixed[i])
+                                continue;
+                            theta_acc = theta.pow(theta_powers[i]);
+                            for (std::size_t j = 0; j < this->_z.get_batch_size(i); j++) {
+                                etha_terms.push_back(
+                                    {&this->_polys[i][j], theta_acc, _fixed_polys_values[i][j], i, j});
+                                theta_acc *= theta;
+                            }
+                        }
+                        if (!etha_terms.empty()) {
+                            points.push_back(_etha);
+                            terms.push_back(std::move(etha_terms));
+                        }
+
+                        // Division by (x - point) lowers the degree by one.
+                        std::size_t combined_Q_degree = 0;
+                        for (auto const &point_terms : terms) {
+                            for (auto const &term : point_terms) {
+                                combined_Q_degree = std::max(combined_Q_degree, term.poly->degree());
+                            }
+                        }
+                        const std::size_t lde_size = _fri_params.D[0]->size();
+                        const value_type omega = _fri_params.D[0]->get_domain_element(1);
+                        polynomial_type combined_Q(combined_Q_degree > 0 ? combined_Q_degree - 1 : 0, lde_size);
+
+                        std::map<std::size_t, polynomial_type> lde_numerators = combine_numerators_from_lde_store(terms);
+                        for (std::size_t point_index = 0; point_index < points.size(); ++point_index) {
+                            if (terms[point_index].empty())
+                                continue;
+
+                            polynomial_type numerator;
+                            auto lde_it = lde_numerators.find(point_index);
+                            if (lde_it != lde_numerators.end()) {
+                                numerator = std::move(lde_it->second);
+                            } else {
+                                numerator = combine_numerator_terms(terms[point_index]);
+                                if (numerator.size() != lde_size) {
+                                    numerator.resize(lde_size, nullptr, _fri_params.D[0]);
+                                }
+                            }
+
+                            // combined_Q(x) += numerator(x) / (x - point) for all x in D[0].
+                            const value_type &point = points[point_index];
+                            parallel_for_chunks(
+                                lde_size,
+                                [&combined_Q, &numerator, &point, &omega](std::size_t begin, std::size_t end) {
+                                    std::vector<value_type> denominators(end - begin);
+                                    value_type x = omega.pow(begin);
+                                    for (std::size_t k = begin; k < end; ++k, x *= omega) {
+                                        denominators[k - begin] = x - point;
+                                    }
+                                    math::detail::serial_batch_inversion(denominators.begin(), denominators.end());
+                                    for (std::size_t k = begin; k < end; ++k) {
+                                        combined_Q[k] += numerator[k] * denominators[k - begin];
+                                    }
+                                },
+                                ThreadPool::PoolLevel::LOW);
+                        }
+
+                        return combined_Q;
+                    }
+
+                    /** \brief Computes combined_Q through the coefficient form. Used for the polynomials in
+                     *  coefficient form, and for the evaluation form when some point lies in D[0].
+                     */
+                    polynomial_type prepare_combined_Q_coefficients(
+                            const typename field_type::value_type& theta,
+                            std::size_t starting_power = 0) {
                         this->build_points_map();
 
                         typename field_type::value_type theta_acc = theta.pow(starting_power);
@@ -425,6 +590,169 @@ namespace nil {
                         return combined_Q;
                     }
 
+                    // Returns true if some evaluation point is a root of unity of the order |D[0]|, i.e. lies in D[0].
+                    // The evaluation form of combined_Q can not be used then, as (x - point) has no inverse there.
+                    bool has_eval_point_in_lde_domain() {
+                        const std::size_t lde_size = _fri_params.D[0]->size();
+                        for (auto const &point : this->get_unique_points()) {
+                            if (point.pow(lde_size) == value_type::one())
+                                return true;
+                        }
+                        for (auto const &[i, fixed] : _batch_fixed) {
+                            if (fixed && _etha.pow(lde_size) == value_type::one())
+                                return true;
+                        }
+                        return false;
+                    }
+
+                    // Returns sum of theta^k * (f_k(x) - z_k) over the terms in evaluation form, on the largest
+                    // domain of the polynomials in 'terms'. The terms of the same size are summed on their own domain,
+                    // each value is a linear combination reduced once, and only that sum is extended. So at most one
+                    // extended polynomial exists at a time.
+                    template<typename TermsRange>
+                    static polynomial_type combine_numerator_terms(const TermsRange &terms) {
+                        typedef algebra::fields::detail::element_accumulator<value_type> accumulator_type;
+
+                        // Terms grouped by polynomial size, the largest size first.
+                        std::map<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>> groups;
+                        std::vector<const polynomial_type *> polys;
+                        std::vector<value_type> theta_powers;
+                        std::size_t degree = 0;
+                        accumulator_type constant_accum;
+                        for (auto const &term : terms) {
+                            groups[term.poly->size()].push_back(polys.size());
+                            polys.push_back(term.poly);
+                            theta_powers.push_back(term.theta_power);
+                            degree = std::max(degree, term.poly->degree());
+                            constant_accum.multiply_add(term.theta_power, term.value);
+                        }
+                        const value_type constant = constant_accum.reduce();
+                        const std::size_t size = groups.begin()->first;
+
+                        // Writes the linear combination of the group minus 'offset' into 'result'.
+                        auto combine_group = [&polys, &theta_powers](const std::vector<std::size_t> &group,
+                                                                     const value_type &offset, polynomial_type &result) {
+                            parallel_for_chunks(
+                                result.size(),
+                                [&polys, &theta_powers, &group, &offset, &result](std::size_t begin, std::size_t end) {
+                                    for (std::size_t k = begin; k < end; ++k) {
+                                        accumulator_type accum;
+                                        for (std::size_t t : group) {
+                                            accum.multiply_add(theta_powers[t], (*polys[t])[k]);
+                                        }
+                                        result[k] = accum.reduce() - offset;
+                                    }
+                                },
+                                ThreadPool::PoolLevel::LOW);
+                        };
+
+                        polynomial_type numerator(degree, size);
+                        combine_group(groups.begin()->second, constant, numerator);
+                        for (auto const &[group_size, group] : groups) {
+                            if (group_size == size)
+                                continue;
+                            std::size_t group_degree = 0;
+                            for (std::size_t t : group) {
+                                group_degree = std::max(group_degree, polys[t]->degree());
+                            }
+                            polynomial_type part(group_degree, group_size);
+                            combine_group(group, value_type::zero(), part);
+                            part.resize(size);
+                            parallel_for_chunks(
+                                size,
+                                [&numerator, &part](std::size_t begin, std::size_t end) {
+                                    for (std::size_t k = begin; k < end; ++k) {
+                                        numerator[k] += part[k];
+                                    }
+                                },
+                                ThreadPool::PoolLevel::LOW);
+                        }
+                        return numerator;
+                    }
+
+                    // Sums the numerators of 'terms' on D[0] from the values kept in the LDE store, for the points where all
+                    // the batches are kept and 'lde_sum_is_cheaper'. The kept batches are read one at a time. Returns
+                    // the numerators by point index, the other points are left to 'combine_numerator_terms'.
+                    template<typename Term>
+                    std::map<std::size_t, polynomial_type> combine_numerators_from_lde_store(
+                            const std::vector<std::vector<Term>> &terms) const {
+                        typedef algebra::fields::detail::element_accumulator<value_type> accumulator_type;
+
+                        const std::size_t lde_size = _fri_params.D[0]->size();
+                        std::map<std::size_t, polynomial_type> numerators;
+                        std::set<std::size_t> batches;
+                        for (std::size_t point_index = 0; point_index < terms.size(); ++point_index) {
+                            const auto &point_terms = terms[point_index];
+                            if (point_terms.empty() || !lde_sum_is_cheaper(point_terms, lde_size) ||
+                                    !std::all_of(point_terms.begin(), point_terms.end(),
+                                                 [this](const Term &term) {return _lde_store.contains(term.batch);}))
+                                continue;
+
+                            std::size_t degree = 0;
+                            accumulator_type constant_accum;
+                            for (auto const &term : point_terms) {
+                                degree = std::max(degree, term.poly->degree());
+                                constant_accum.multiply_add(term.theta_power, term.value);
+                                batches.insert(term.batch);
+                            }
+                            numerators.emplace(point_index, polynomial_type(degree, lde_size, -constant_accum.reduce()));
+                        }
+
+                        for (std::size_t batch : batches) {
+                            const auto batch_values = _lde_store.get(batch);
+                            for (auto &[point_index, numerator] : numerators) {
+                                std::vector<const polynomial_type *> polys;
+                                std::vector<value_type> theta_powers;
+                                for (auto const &term : terms[point_index]) {
+                                    if (term.batch == batch) {
+                                        polys.push_back(&(*batch_values)[term.index]);
+                                        theta_powers.push_back(term.theta_power);
+                                    }
+                                }
+                                if (polys.empty())
+                                    continue;
+
+                                parallel_for_chunks(
+                                    lde_size,
+                                    [&numerator = numerator, &polys, &theta_powers](std::size_t begin, std::size_t end) {
+                                        for (std::size_t k = begin; k < end; ++k) {
+                                            accumulator_type accum;
+                                            for (std::size_t t = 0; t < polys.size(); ++t) {
+                                                accum.multiply_add(theta_powers[t], (*polys[t])[k]);
+                                            }
+                                            numerator[k] += accum.reduce();
+                                        }
+                                    },
+                                    ThreadPool::PoolLevel::LOW);
+                            }
+                        }
+                        return numerators;
+                    }
+
+                    // Returns true if summing the terms on D[0] takes fewer multiplications than summing them on their
+                    // largest domain and extending the sum to D[0]. An FFT of size n is counted as n * log2(n).
+                    template<typename TermsRange>
+                    static bool lde_sum_is_cheaper(const TermsRange &terms, std::size_t lde_size) {
+                        auto fft_cost = [](std::size_t n) {
+                            std::size_t cost = 0;
+                            for (std::size_t k = n; k > 1; k >>= 1) {
+                                cost += n;
+                            }
+                            return cost;
+                        };
+                        std::size_t size = 0;
+                        for (auto const &term : terms) {
+                            size = std::max(size, term.poly->size());
+                        }
+                        std::size_t extension_cost = fft_cost(size) + fft_cost(lde_size);
+                        for (auto const &term : terms) {
+                            if (term.poly->size() != size) {
+                                extension_cost += fft_cost(term.poly->size()) + fft_cost(size);
+                            }
+                        }
+                        return terms.size() * (lde_size - size) <= extension_cost;
+                    }
+
                     // Computes and returns the maximal power of theta used to compute the value of Combined_Q.
                     std::size_t compute_theta_power_for_combined_Q() {
                         std::size_t theta_power = 0;
@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_DETAIL_BULK_COLUMN_WRITER_HPP
+#define CRYPTO3_ZK_DETAIL_BULK_COLUMN_WRITER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <future>
+#include <ostream>
+#include <vector>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace detail {
+
+                // Writes table columns encoded in bulk. A column is encoded block by block into a contiguous buffer in
+                // parallel, and each block is written with a single call by a task of the pool, so that writing a block
+                // overlaps with encoding of the next one.
+                class bulk_column_writer {
+                public:
+                    // Rows encoded and written at once.
+                    static constexpr std::size_t block_rows = 1 << 16;
+                    // Rows encoded by one call of 'encode_rows'.
+                    static constexpr std::size_t chunk_rows = 4096;
+
+                    explicit bulk_column_writer(std::ostream& out) : out_(out) {
+                    }
+
+                    bulk_column_writer(const bulk_column_writer&) = delete;
+                    bulk_column_writer& operator=(const bulk_column_writer&) = delete;
+
+                    ~bulk_column_writer() {
+                        if (pending_.valid()) {
+                            ThreadPool::wait(pending_);
+                        }
+                    }
+
+                    // Writes 'rows' elements of 'element_size' bytes. encode_rows(begin, end, out) must encode rows
+                    // [begin, end) into out, it is called concurrently for disjoint ranges. The first exception
+                    // thrown by 'encode_rows' is rethrown here.
+                    template<typename EncodeRows>
+                    void write_column(std::size_t rows, std::size_t element_size, const EncodeRows& encode_rows) {
+                        for (std::size_t begin = 0; begin < rows; begin += block_rows) {
+                            const std::size_t end = std::min(rows, begin + block_rows);
+                            // The other buffer may still be written, this one is not used anymore.
+                            auto& buffer = buffers_[current_buffer_];
+                            buffer.resize((end - begin) * element_size);
+                            std::uint8_t* out = buffer.data();
+
+                            const std::size_t chunks = (end - begin + chunk_rows - 1) / chunk_rows;
+                            parallel_for(0, chunks, [begin, end, element_size, out, &encode_rows](std::size_t chunk) {
+                                const std::size_t chunk_begin = begin + chunk * chunk_rows;
+                                const std::size_t chunk_end = std::min(end, chunk_begin + chunk_rows);
+                                encode_rows(chunk_begin, chunk_end, out + (chunk_begin - begin) * element_size);
+                            }, ThreadPool::PoolLevel::LOW);
+
+                            flush();
+                            auto& pool = ThreadPool::get_instance(ThreadPool::PoolLevel::HIGH);
+                            pending_ = pool.post<void>([this, &buffer]() {
+                                out_.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+                            });
+                            current_buffer_ ^= 1;
+                        }
+                    }
+
+                    // Waits for the pending write. Must be called before writing to the stream directly.
+                    void flush() {
+                        if (pending_.valid()) {
+                            ThreadPool::wait(pending_);
+                            pending_.get();
+                        }
+                    }
+
+                private:
+                    std::ostream& out_;
+                    std::array<std::vector<std::uint8_t>, 2> buffers_;
+                    std::size_t current_buffer_ = 0;
+                    std::future<void> pending_;
+                };
+
+            }    // namespace detail
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_DETAIL_BULK_COLUMN_WRITER_HPP
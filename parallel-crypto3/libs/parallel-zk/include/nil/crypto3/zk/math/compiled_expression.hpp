@@ -0,0 +1,362 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_MATH_COMPILED_EXPRESSION_HPP
+#define CRYPTO3_ZK_MATH_COMPILED_EXPRESSION_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/apply_visitor.hpp>
+
+#include <nil/crypto3/zk/math/expression.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * An expression lowered into a flat register-based program.
+             *
+             * Every variable of the expression gets an index into 'variables()', the caller resolves them once to
+             * pointers to the column values, so no lookups are done per row. Equal subexpressions are computed only
+             * once, and registers are reused as soon as their last reader has executed.
+             *
+             * The program is executed over blocks of rows: each instruction runs over the whole block before the
+             * next one starts, so the interpretation overhead is paid once per block and not once per row.
+             */
+            template<typename VariableType>
+            class compiled_expression {
+            public:
+                typedef VariableType variable_type;
+                typedef typename VariableType::assignment_type value_type;
+
+                static constexpr std::size_t DEFAULT_BLOCK_SIZE = 64;
+
+                enum class opcode : std::uint8_t { ADD, SUB, MUL, POW };
+
+                struct operand {
+                    enum class kind : std::uint8_t { REGISTER, VARIABLE, CONSTANT };
+
+                    kind type;
+                    std::size_t index;
+
+                    bool operator<(const operand &other) const {
+                        return std::tie(type, index) < std::tie(other.type, other.index);
+                    }
+                    bool operator==(const operand &other) const {
+                        return type == other.type && index == other.index;
+                    }
+                };
+
+                struct instruction {
+                    opcode op;
+                    std::size_t dst;
+                    operand lhs;
+                    // Unused for POW.
+                    operand rhs;
+                    std::size_t power;
+                };
+
+                explicit compiled_expression(const math::expression<VariableType> &expr) {
+                    compiler c(*this);
+                    c.compile(expr);
+                }
+
+                // Variables in the order the columns must be passed to 'evaluate'.
+                const std::vector<variable_type> &variables() const {
+                    return vars;
+                }
+
+                const std::vector<instruction> &instructions() const {
+                    return program;
+                }
+
+                std::size_t registers_count() const {
+                    return registers;
+                }
+
+                /**
+                 * Evaluates the expression on rows [begin, end) and writes the results to out[0, end - begin).
+                 * Thread safe, all the scratch memory belongs to the call.
+                 *
+                 * @param columns - columns[i] points to the values of variables()[i], indexed by row.
+                 */
+                void evaluate(const std::vector<const value_type *> &columns, std::size_t begin, std::size_t end,
+                              value_type *out, std::size_t block_size = DEFAULT_BLOCK_SIZE) const {
+                    if (columns.size() != vars.size()) {
+                        throw std::invalid_argument("compiled_expression: wrong number of columns");
+                    }
+                    block_size = std::max<std::size_t>(1, std::min(block_size, end - begin));
+                    std::vector<value_type> scratch(registers * block_size);
+
+                    for (std::size_t block_begin = begin; block_begin < end; block_begin += block_size) {
+                        const std::size_t rows = std::min(block_size, end - block_begin);
+
+                        for (const instruction &ins : program) {
+                            value_type *dst = scratch.data() + ins.dst * block_size;
+                            const value_type *lhs;
+                            std::size_t lhs_stride;
+                            std::tie(lhs, lhs_stride) = resolve(ins.lhs, columns, scratch, block_begin, block_size);
+
+                            if (ins.op == opcode::POW) {
+                                for (std::size_t r = 0; r < rows; ++r) {
+                                    dst[r] = lhs[r * lhs_stride].pow(ins.power);
+                                }
+                                continue;
+                            }
+
+                            const value_type *rhs;
+                            std::size_t rhs_stride;
+                            std::tie(rhs, rhs_stride) = resolve(ins.rhs, columns, scratch, block_begin, block_size);
+
+                            switch (ins.op) {
+                                case opcode::ADD:
+                                    for (std::size_t r = 0; r < rows; ++r) {
+                                        dst[r] = lhs[r * lhs_stride] + rhs[r * rhs_stride];
+                                    }
+                                    break;
+                                case opcode::SUB:
+                                    for (std::size_t r = 0; r < rows; ++r) {
+                                        dst[r] = lhs[r * lhs_stride] - rhs[r * rhs_stride];
+                                    }
+                                    break;
+                                case opcode::MUL:
+                                    for (std::size_t r = 0; r < rows; ++r) {
+                                        dst[r] = lhs[r * lhs_stride] * rhs[r * rhs_stride];
+                                    }
+                                    break;
+                                default:
+                                    break;
+                            }
+                        }
+
+                        const value_type *res;
+                        std::size_t res_stride;
+                        std::tie(res, res_stride) = resolve(result, columns, scratch, block_begin, block_size);
+                        for (std::size_t r = 0; r < rows; ++r) {
+                            out[block_begin - begin + r] = res[r * res_stride];
+                        }
+                    }
+                }
+
+            private:
+                // Returns the pointer to the value of 'op' on the first row of the block, and the distance between
+                // the rows, which is 0 for constants.
+                std::pair<const value_type *, std::size_t>
+                    resolve(const operand &op, const std::vector<const value_type *> &columns,
+                            const std::vector<value_type> &scratch, std::size_t block_begin,
+                            std::size_t block_size) const {
+                    switch (op.type) {
+                        case operand::kind::REGISTER:
+                            return {scratch.data() + op.index * block_size, 1};
+                        case operand::kind::VARIABLE:
+                            return {columns[op.index] + block_begin, 1};
+                        default:
+                            return {&constants[op.index], 0};
+                    }
+                }
+
+                // Lowers the expression tree into 'program'. Values are first numbered in SSA form, registers are
+                // assigned after all the instructions are known.
+                class compiler : public boost::static_visitor<operand> {
+                public:
+                    explicit compiler(compiled_expression &owner) : owner(owner) {
+                    }
+
+                    void compile(const math::expression<VariableType> &expr) {
+                        operand res = visit(expr);
+                        allocate_registers(res);
+                    }
+
+                    operand operator()(const math::term<VariableType> &t) const {
+                        if (t.get_coeff().is_zero() || t.get_vars().empty()) {
+                            return constant(t.get_coeff());
+                        }
+                        operand res = variable(t.get_vars()[0]);
+                        for (std::size_t i = 1; i < t.get_vars().size(); ++i) {
+                            res = emit(opcode::MUL, res, variable(t.get_vars()[i]));
+                        }
+                        if (!t.get_coeff().is_one()) {
+                            res = emit(opcode::MUL, res, constant(t.get_coeff()));
+                        }
+                        return res;
+                    }
+
+                    operand operator()(const math::pow_operation<VariableType> &p) const {
+                        operand base = visit(p.get_expr());
+                        if (p.get_power() == 0) {
+                            return constant(value_type::one());
+                        }
+                        if (p.get_power() == 1) {
+                            return base;
+                        }
+                        return emit(opcode::POW, base, base, p.get_power());
+                    }
+
+                    operand operator()(const math::binary_arithmetic_operation<VariableType> &op) const {
+                        operand lhs = visit(op.get_expr_left());
+                        operand rhs = visit(op.get_expr_right());
+                        switch (op.get_op()) {
+                            case ArithmeticOperator::ADD:
+                                return emit(opcode::ADD, lhs, rhs);
+                            case ArithmeticOperator::SUB:
+                                return emit(opcode::SUB, lhs, rhs);
+                            default:
+                                return emit(opcode::MUL, lhs, rhs);
+                        }
+                    }
+
+                private:
+                    // Subexpressions are remembered by address, the tree outlives the compiler. Equal subtrees at
+                    // different addresses are found through their hash.
+                    operand visit(const math::expression<VariableType> &expr) const {
+                        auto &bucket = expression_values[expr.get_hash()];
+                        for (const auto &entry : bucket) {
+                            if (entry.first == &expr || *entry.first == expr) {
+                                return entry.second;
+                            }
+                        }
+                        operand res = boost::apply_visitor(*this, expr.get_expr());
+                        expression_values[expr.get_hash()].emplace_back(&expr, res);
+                        return res;
+                    }
+
+                    operand variable(const variable_type &var) const {
+                        auto it = variable_indices.find(var);
+                        if (it != variable_indices.end()) {
+                            return {operand::kind::VARIABLE, it->second};
+                        }
+                        variable_indices[var] = owner.vars.size();
+                        owner.vars.push_back(var);
+                        return {operand::kind::VARIABLE, owner.vars.size() - 1};
+                    }
+
+                    operand constant(const value_type &value) const {
+                        auto it = constant_indices.find(value);
+                        if (it != constant_indices.end()) {
+                            return {operand::kind::CONSTANT, it->second};
+                        }
+                        constant_indices[value] = owner.constants.size();
+                        owner.constants.push_back(value);
+                        return {operand::kind::CONSTANT, owner.constants.size() - 1};
+                    }
+
+                    // Emits an instruction unless the same one was emitted before. Operands of the commutative
+                    // operations are ordered, so a * b and b * a are computed once.
+                    operand emit(opcode op, operand lhs, operand rhs, std::size_t power = 0) const {
+                        if ((op == opcode::ADD || op == opcode::MUL) && rhs < lhs) {
+                            std::swap(lhs, rhs);
+                        }
+                        auto key = std::make_tuple(op, lhs, rhs, power);
+                        auto it = instruction_values.find(key);
+                        if (it != instruction_values.end()) {
+                            return it->second;
+                        }
+                        // Until registers are allocated, 'dst' and the register operands hold SSA value numbers.
+                        operand res = {operand::kind::REGISTER, owner.program.size()};
+                        owner.program.push_back({op, owner.program.size(), lhs, rhs, power});
+                        instruction_values.emplace(key, res);
+                        return res;
+                    }
+
+                    // Maps SSA values to registers, a register is released after the last instruction reading it.
+                    void allocate_registers(operand res) {
+                        auto &program = owner.program;
+                        std::vector<std::size_t> last_use(program.size(), 0);
+                        for (std::size_t i = 0; i < program.size(); ++i) {
+                            last_use[i] = i;
+                            for (const operand *op : {&program[i].lhs, &program[i].rhs}) {
+                                if (op->type == operand::kind::REGISTER) {
+                                    last_use[op->index] = i;
+                                }
+                            }
+                        }
+                        if (res.type == operand::kind::REGISTER) {
+                            last_use[res.index] = program.size();
+                        }
+
+                        std::vector<std::size_t> value_register(program.size());
+                        std::vector<std::size_t> free_registers;
+                        std::size_t registers = 0;
+                        for (std::size_t i = 0; i < program.size(); ++i) {
+                            instruction &ins = program[i];
+                            const operand lhs_value = ins.lhs;
+                            const operand rhs_value = ins.rhs;
+                            for (operand *op : {&ins.lhs, &ins.rhs}) {
+                                if (op->type == operand::kind::REGISTER) {
+                                    op->index = value_register[op->index];
+                                }
+                            }
+                            // Operands dying here can be overwritten by the result, instructions are applied
+                            // row by row so every row reads its operands before writing.
+                            if (lhs_value.type == operand::kind::REGISTER && last_use[lhs_value.index] == i) {
+                                free_registers.push_back(ins.lhs.index);
+                            }
+                            if (rhs_value.type == operand::kind::REGISTER && last_use[rhs_value.index] == i &&
+                                !(rhs_value == lhs_value)) {
+                                free_registers.push_back(ins.rhs.index);
+                            }
+                            if (free_registers.empty()) {
+                                value_register[i] = registers++;
+                            } else {
+                                value_register[i] = free_registers.back();
+                                free_registers.pop_back();
+                            }
+                            ins.dst = value_register[i];
+                        }
+                        if (res.type == operand::kind::REGISTER) {
+                            res.index = value_register[res.index];
+                        }
+                        owner.registers = registers;
+                        owner.result = res;
+                    }
+
+                    compiled_expression &owner;
+
+                    mutable std::unordered_map<std::size_t,
+                                               std::vector<std::pair<const math::expression<VariableType> *, operand>>>
+                        expression_values;
+                    mutable std::unordered_map<variable_type, std::size_t> variable_indices;
+                    mutable std::unordered_map<value_type, std::size_t> constant_indices;
+                    mutable std::map<std::tuple<opcode, operand, operand, std::size_t>, operand> instruction_values;
+                };
+
+                std::vector<variable_type> vars;
+                std::vector<value_type> constants;
+                std::vector<instruction> program;
+                std::size_t registers = 0;
+                operand result = {operand::kind::CONSTANT, 0};
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_MATH_COMPILED_EXPRESSION_HPP
@@ -50,6 +50,7 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
 #include <nil/crypto3/zk/math/expression.hpp>
 #include <nil/crypto3/zk/math/expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/compiled_expression.hpp>
 #include <nil/crypto3/zk/math/expression_visitors.hpp>
 
 #include <nil/crypto3/bench/scoped_profiler.hpp>
@@ -78,6 +79,10 @@ namespace nil {
 
                     constexpr static const std::size_t argument_size = 1;
 
+                    // Witness and public input columns are taken from 'variable_values_lde' when it is given. These
+                    // are the same columns extended to the FRI domain D[0], kept by the commitment scheme. If |D[0]|
+                    // is a multiple of the extended domain size, the values on the extended domain are every
+                    // (|D[0]| / extended_domain_size)-th value there, so no FFT is needed.
                     static inline void build_variable_value_map(
                         const math::expression<variable_type>& expr,
                         const plonk_polynomial_dfs_table<FieldType>& assignments,
@@ -85,7 +90,8 @@ namespace nil {
                         std::size_t extended_domain_size,
                         std::unordered_map<variable_type, polynomial_dfs_type>& variable_values_out,
                         const polynomial_dfs_type &mask_polynomial,
-                        const polynomial_dfs_type &lagrange_0
+                        const polynomial_dfs_type &lagrange_0,
+                        const std::vector<polynomial_dfs_type> *variable_values_lde = nullptr
                     ) {
 
                         std::unordered_map<variable_type, size_t> variable_counts;
@@ -109,10 +115,30 @@ namespace nil {
                         std::shared_ptr<math::evaluation_domain<FieldType>> extended_domain =
                             math::make_evaluation_domain<FieldType>(extended_domain_size);
 
+                        const std::size_t witnesses_amount = assignments.witnesses_amount();
+                        const bool use_lde = variable_values_lde != nullptr && !variable_values_lde->empty() &&
+                            variable_values_lde->front().size() % extended_domain_size == 0;
+
                         parallel_for(0, variables.size(),
-                            [&variables, &variable_values_out, &assignments, &domain, &extended_domain, extended_domain_size, &mask_polynomial, &lagrange_0](std::size_t i) {
+                            [&variables, &variable_values_out, &assignments, &domain, &extended_domain, extended_domain_size, &mask_polynomial, &lagrange_0,
+                             variable_values_lde, use_lde, witnesses_amount](std::size_t i) {
                                 const variable_type& var = variables[i];
 
+                                if (use_lde && (var.type == variable_type::column_type::witness ||
+                                                var.type == variable_type::column_type::public_input)) {
+                                    const polynomial_dfs_type& lde = (*variable_values_lde)[
+                                        var.type == variable_type::column_type::witness ? var.index : witnesses_amount + var.index];
+                                    const std::size_t lde_size = lde.size();
+                                    const std::size_t stride = lde_size / extended_domain_size;
+                                    const std::size_t shift = (lde_size + (lde_size / domain->m) * var.rotation) % lde_size;
+                                    polynomial_dfs_type assignment(lde.degree(), extended_domain_size);
+                                    for (std::size_t k = 0; k < extended_domain_size; ++k) {
+                                        assignment[k] = lde[(k * stride + shift) % lde_size];
+                                    }
+                                    variable_values_out[var] = std::move(assignment);
+                                    return;
+                                }
+
                                 // Convert the variable to polynomial_dfs variable type.
                                 polynomial_dfs_variable_type var_dfs(var.index, var.rotation, var.relative,
                                     static_cast<typename polynomial_dfs_variable_type::column_type>(
@@ -140,7 +166,8 @@ namespace nil {
                         std::uint32_t max_gates_degree,
                         const polynomial_dfs_type &mask_polynomial,
                         const polynomial_dfs_type &lagrange_0,
-                        transcript_type& transcript
+                        transcript_type& transcript,
+                        const std::vector<polynomial_dfs_type> *variable_values_lde = nullptr
                     ) {
                         PROFILE_SCOPE("gate_argument_time");
 
@@ -210,25 +237,22 @@ namespace nil {
                             build_variable_value_map(
                                 expressions[i], column_polynomials, original_domain,
                                 extended_domain_sizes[i], variable_values,
-                                mask_polynomial, lagrange_0
+                                mask_polynomial, lagrange_0, variable_values_lde
                             );
 
+                            // Variables are resolved to column pointers once, the rows are then evaluated
+                            // block by block with no map lookups.
+                            math::compiled_expression<variable_type> program(expressions[i]);
+                            std::vector<const typename FieldType::value_type*> columns;
+                            for (const auto& var : program.variables()) {
+                                columns.push_back(variable_values.at(var).data());
+                            }
+
                             polynomial_dfs_type result(extended_domain_sizes[i] - 1, extended_domain_sizes[i]);
                             wait_for_all(parallel_run_in_chunks<void>(
                                 extended_domain_sizes[i],
-                                [&variable_values, &extended_domain_sizes, &result, &expressions, i]
-                                (std::size_t begin, std::size_t end) {
-                                    for (std::size_t j = begin; j < end; ++j) {
-                                        // Don't use cache here. In practice it's slower to maintain the cache
-                                        // than to re-compute the subexpression value when value type is field element.
-                                        math::expression_evaluator<variable_type> evaluator(
-                                            expressions[i],
-                                            [&assignments=variable_values, j]
-                                                (const variable_type &var) -> const typename FieldType::value_type& {
-                                                    return assignments[var][j];
-                                            });
-                                        result[j] = evaluator.evaluate();
-                                    }
+                                [&program, &columns, &result](std::size_t begin, std::size_t end) {
+                                    program.evaluate(columns, begin, end, result.data() + begin);
                             }, ThreadPool::PoolLevel::HIGH));
 
                             F[0] += result;
@@ -38,6 +38,7 @@
 #include <nil/crypto3/math/polynomial/shift.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/batch_inversion.hpp>
 
 #include <nil/crypto3/hash/sha2.hpp>
 
@@ -269,10 +270,9 @@ namespace nil {
 
                             // Inverse the values of reduced-hs in-place.
                             parallel_for(0, lookup_alphas.size(), [&reduced_hs, this](std::size_t i) {
-                                parallel_for(0, this->preprocessed_data.common_data.desc.usable_rows_amount,
-                                    [&reduced_hs, i](std::size_t j) {
-                                        reduced_hs[i][j] = reduced_hs[i][j].inversed();
-                                    },
+                                math::batch_inversion(
+                                    reduced_hs[i].begin(),
+                                    reduced_hs[i].begin() + this->preprocessed_data.common_data.desc.usable_rows_amount,
                                     ThreadPool::PoolLevel::LOW);
                                 },
                                 ThreadPool::PoolLevel::HIGH);
@@ -437,8 +437,12 @@ namespace nil {
                         V_L[0] = FieldType::value_type::one();
                         auto one = FieldType::value_type::one();
 
+                        // Denominators of V_L[k] / V_L[k-1], inverted all at once below.
+                        std::vector<typename FieldType::value_type> h_values(
+                            preprocessed_data.common_data.desc.usable_rows_amount + 1, one);
+
                         parallel_for(1, preprocessed_data.common_data.desc.usable_rows_amount + 1,
-                                [&one, &beta, &V_L, &reduced_input, &reduced_value, &sorted, &gamma](std::size_t k) {
+                                [&one, &beta, &V_L, &h_values, &reduced_input, &reduced_value, &sorted, &gamma](std::size_t k) {
                             typename FieldType::value_type g_tmp = (one + beta).pow(reduced_input.size());
                             for (std::size_t i = 0; i < reduced_input.size(); i++) {
                                 g_tmp *= gamma + reduced_input[i][k-1];
@@ -455,13 +459,20 @@ namespace nil {
                             for (std::size_t i = 0; i < sorted.size(); i++) {
                                 h_tmp *= part1 + sorted[i][k-1] + beta * sorted[i][k];
                             }
-                            V_L[k] *= h_tmp.inversed();
+                            h_values[k] = h_tmp;
                         }, ThreadPool::PoolLevel::HIGH);
 
-                        // TODO(martun): we can parallize the lower loop as well, but it's fast enough to ignore for now.
-                        for (std::size_t k = 1; k <= preprocessed_data.common_data.desc.usable_rows_amount; k++) {
-                            V_L[k] *= V_L[k-1];
-                        }
+                        math::batch_inversion(h_values, ThreadPool::PoolLevel::LOW);
+                        parallel_for(1, preprocessed_data.common_data.desc.usable_rows_amount + 1,
+                            [&V_L, &h_values](std::size_t k) {
+                                V_L[k] *= h_values[k];
+                            }, ThreadPool::PoolLevel::LOW);
+
+                        parallel_inclusive_scan(
+                            V_L.begin(), V_L.begin() + preprocessed_data.common_data.desc.usable_rows_amount + 1,
+                            [](const typename FieldType::value_type& a, const typename FieldType::value_type& b) {
+                                return a * b;
+                            }, ThreadPool::PoolLevel::LOW);
 
                         return V_L;
                     }
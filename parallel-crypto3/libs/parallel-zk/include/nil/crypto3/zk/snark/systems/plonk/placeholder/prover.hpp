@@ -185,14 +185,25 @@ namespace nil {
                         );
                         mask_polynomial -= preprocessed_public_data.q_last;
                         mask_polynomial -= preprocessed_public_data.q_blind;
+
+                        // The variable columns extended to D[0] by the commitment, if the LPC keeps them in
+                        // memory. A spilled batch is not loaded: it would stay whole in memory for all of the gate
+                        // argument, so the columns are extended one by one instead.
+                        std::shared_ptr<const std::vector<polynomial_dfs_type>> variable_values_lde;
+                        if constexpr (nil::crypto3::zk::is_lpc<commitment_scheme_type>) {
+                            variable_values_lde =
+                                _commitment_scheme.get_lde_store().get_in_memory(VARIABLE_VALUES_BATCH);
+                        }
                         _F_dfs[7] = placeholder_gates_argument<FieldType, ParamsType>::prove_eval(
                             constraint_system, *_polynomial_table,
                             preprocessed_public_data.common_data.basic_domain,
                             preprocessed_public_data.common_data.max_gates_degree,
                             mask_polynomial,
                             preprocessed_public_data.common_data.lagrange_0,
-                            transcript
+                            transcript,
+                            variable_values_lde.get()
                         )[0];
+                        variable_values_lde.reset();
 
                         _polynomial_table.reset(); // We don't need it anymore, release memory
 
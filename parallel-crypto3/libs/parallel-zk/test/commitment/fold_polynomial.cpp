@@ -38,6 +38,8 @@
 #include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
 #include <nil/crypto3/algebra/curves/vesta.hpp>
 #include <nil/crypto3/algebra/fields/arithmetic_params/vesta.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/goldilocks64.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
@@ -134,6 +136,44 @@ void test_fold_polynomial_dfs() {
     BOOST_CHECK(x1 == x2);
 }
 
+// Folding several rounds at once gives the same codeword as folding them one by one.
+template<typename FieldType>
+void test_fold_polynomial_dfs_rounds() {
+    using value_type = typename FieldType::value_type;
+
+    // Large enough for the folding to be split into several chunks.
+    std::vector<std::shared_ptr<math::evaluation_domain<FieldType>>> D =
+            math::calculate_domain_set<FieldType>(14, 6);
+
+    std::vector<value_type> f_vector(D[0]->size(), value_type::zero());
+    for (std::size_t i = 0; i < D[0]->size() / 4; i++) {
+        f_vector[i] = algebra::random_element<FieldType>();
+    }
+    D[0]->fft(f_vector);
+    math::polynomial_dfs<value_type> f_dfs(D[0]->size() / 4 - 1, f_vector.begin(), f_vector.end());
+
+    std::vector<value_type> inv_twiddles = zk::commitments::detail::fold_inverse_twiddles<FieldType>(D[0]);
+
+    for (std::size_t start : {0, 2}) {
+        math::polynomial_dfs<value_type> f_start = f_dfs;
+        for (std::size_t t = 0; t < start; t++) {
+            f_start = zk::commitments::detail::fold_polynomial<FieldType>(
+                f_start, algebra::random_element<FieldType>(), D[t]);
+        }
+        for (std::size_t rounds = 1; rounds <= 4; rounds++) {
+            std::vector<value_type> alphas;
+            math::polynomial_dfs<value_type> expected = f_start;
+            for (std::size_t t = start; t < start + rounds; t++) {
+                alphas.push_back(algebra::random_element<FieldType>());
+                expected = zk::commitments::detail::fold_polynomial<FieldType>(expected, alphas.back(), D[t]);
+            }
+            math::polynomial_dfs<value_type> folded = zk::commitments::detail::fold_polynomial_rounds<FieldType>(
+                f_start, alphas, inv_twiddles, std::size_t(1) << start);
+            BOOST_CHECK(folded == expected);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(fold_polynomial_test_suite)
 
     BOOST_AUTO_TEST_CASE(fold_polynomial_test) {
@@ -153,4 +193,10 @@ BOOST_AUTO_TEST_SUITE(fold_polynomial_test_suite)
         test_fold_polynomial_dfs<algebra::curves::vesta>();
     }
 
+    BOOST_AUTO_TEST_CASE(fold_polynomial_dfs_rounds_test) {
+        test_fold_polynomial_dfs_rounds<algebra::fields::pallas_base_field>();
+
+        test_fold_polynomial_dfs_rounds<algebra::fields::goldilocks64>();
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
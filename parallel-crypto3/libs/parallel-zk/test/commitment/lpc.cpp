@@ -29,6 +29,7 @@
 #define BOOST_TEST_MODULE lpc_test
 
 #include <string>
+#include <fstream>
 #include <random>
 #include <regex>
 
@@ -130,6 +131,33 @@ inline std::vector<math::polynomial_dfs<typename FieldType::value_type>> generat
     return result;
 }
 
+// Returns the value of the given memory counter of /proc/self/status in bytes, 0 if it is not available.
+inline std::size_t read_process_memory_counter(const std::string &name) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind(name + ":", 0) == 0) {
+            return std::stoul(line.substr(name.size() + 1)) * 1024;
+        }
+    }
+    return 0;
+}
+
+// Resets the peak resident set size of the process to the current one, returns false if it is not supported.
+inline bool reset_peak_rss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+    clear_refs.flush();
+    return clear_refs.good() && read_process_memory_counter("VmHWM") != 0;
+}
+
+// Precondition of the tests which measure the peak resident set size, they are skipped where it can not be reset.
+inline boost::test_tools::assertion_result peak_rss_can_be_reset(boost::unit_test::test_unit_id) {
+    boost::test_tools::assertion_result result(reset_peak_rss());
+    result.message() << "peak RSS can not be reset through /proc/self/clear_refs";
+    return result;
+}
+
 std::size_t test_global_seed = 0;
 boost::random::mt11213b test_global_rnd_engine;
 template<typename FieldType>
@@ -459,6 +487,268 @@ BOOST_AUTO_TEST_SUITE(lpc_math_polynomial_suite);
         BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
     }
 
+    BOOST_FIXTURE_TEST_CASE(lpc_dfs_combined_Q_evaluation_form_test, test_fixture) {
+        typedef algebra::curves::bls12<381> curve_type;
+        typedef typename curve_type::scalar_field_type FieldType;
+
+        typedef hashes::sha2<256> merkle_hash_type;
+        typedef hashes::sha2<256> transcript_hash_type;
+
+        constexpr static const std::size_t lambda = 10;
+        constexpr static const std::size_t d = 16;
+        constexpr static const std::size_t m = 2;
+
+        typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+        typedef zk::commitments::
+        list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m>
+                lpc_params_type;
+        typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+        std::size_t degree_log = std::ceil(std::log2(d - 1));
+        typename fri_type::params_type fri_params(
+                1, /*max_step*/
+                degree_log,
+                lambda,
+                4 //expand_factor
+                );
+
+        using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type>;
+        lpc_scheme_type lpc_scheme_prover(fri_params);
+
+        // Batches of different polynomial sizes, opened at shared and distinct points.
+        lpc_scheme_prover.append_to_batch(0, generate_random_polynomial_dfs_batch<FieldType>(
+                3, d, test_global_alg_rnd_engine<FieldType>));
+        lpc_scheme_prover.append_to_batch(1, generate_random_polynomial_dfs_batch<FieldType>(
+                2, d / 2, test_global_alg_rnd_engine<FieldType>));
+        lpc_scheme_prover.commit(0);
+        lpc_scheme_prover.commit(1);
+
+        auto point = algebra::fields::arithmetic_params<FieldType>::multiplicative_generator;
+        lpc_scheme_prover.append_eval_point(0, point);
+        lpc_scheme_prover.append_eval_point(1, point);
+        lpc_scheme_prover.append_eval_point(1, point * point);
+
+        std::array<std::uint8_t, 96> x_data{};
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(x_data);
+        lpc_scheme_prover.eval_polys_and_add_roots_to_transcipt(transcript);
+
+        typename FieldType::value_type theta = transcript.template challenge<FieldType>();
+        auto combined_Q = lpc_scheme_prover.prepare_combined_Q_dfs(theta, 3);
+        auto combined_Q_reference = lpc_scheme_prover.prepare_combined_Q_coefficients(theta, 3);
+        BOOST_CHECK_EQUAL(combined_Q.size(), combined_Q_reference.size());
+        BOOST_CHECK(std::equal(combined_Q.begin(), combined_Q.end(), combined_Q_reference.begin()));
+    }
+
+    BOOST_FIXTURE_TEST_CASE(lpc_dfs_combined_Q_fixed_batch_test, test_fixture) {
+        typedef algebra::curves::bls12<381> curve_type;
+        typedef typename curve_type::scalar_field_type FieldType;
+
+        typedef hashes::sha2<256> merkle_hash_type;
+        typedef hashes::sha2<256> transcript_hash_type;
+
+        constexpr static const std::size_t lambda = 10;
+        constexpr static const std::size_t d = 16;
+        constexpr static const std::size_t m = 2;
+
+        typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+        typedef zk::commitments::
+        list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m>
+                lpc_params_type;
+        typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+        std::size_t degree_log = std::ceil(std::log2(d - 1));
+        typename fri_type::params_type fri_params(
+                1, /*max_step*/
+                degree_log,
+                lambda,
+                4 //expand_factor
+                );
+
+        using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type>;
+        lpc_scheme_type lpc_scheme_prover(fri_params);
+
+        // Batch 0 is fixed and is also opened at _etha, batches 1 and 2 have other polynomial sizes.
+        lpc_scheme_prover.append_to_batch(0, generate_random_polynomial_dfs_batch<FieldType>(
+                2, d, test_global_alg_rnd_engine<FieldType>));
+        lpc_scheme_prover.append_to_batch(1, generate_random_polynomial_dfs_batch<FieldType>(
+                3, d / 2, test_global_alg_rnd_engine<FieldType>));
+        lpc_scheme_prover.append_to_batch(2, generate_random_polynomial_dfs_batch<FieldType>(
+                2, d, test_global_alg_rnd_engine<FieldType>));
+        lpc_scheme_prover.commit(0);
+        lpc_scheme_prover.mark_batch_as_fixed(0);
+
+        std::array<std::uint8_t, 96> x_data{};
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(x_data);
+        {
+            zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> preprocess_transcript(x_data);
+            auto preprocessed_data = lpc_scheme_prover.preprocess(preprocess_transcript);
+            lpc_scheme_prover.setup(transcript, preprocessed_data);
+        }
+        lpc_scheme_prover.commit(1);
+        lpc_scheme_prover.commit(2);
+
+        auto point = algebra::fields::arithmetic_params<FieldType>::multiplicative_generator;
+        lpc_scheme_prover.append_eval_point(0, point);
+        lpc_scheme_prover.append_eval_point(1, point);
+        lpc_scheme_prover.append_eval_point(1, point * point);
+        lpc_scheme_prover.append_eval_point(2, point * point * point);
+        lpc_scheme_prover.eval_polys_and_add_roots_to_transcipt(transcript);
+
+        typename FieldType::value_type theta = transcript.template challenge<FieldType>();
+        auto combined_Q = lpc_scheme_prover.prepare_combined_Q_dfs(theta, 3);
+        auto combined_Q_reference = lpc_scheme_prover.prepare_combined_Q_coefficients(theta, 3);
+        BOOST_CHECK_EQUAL(combined_Q.size(), combined_Q_reference.size());
+        BOOST_CHECK(std::equal(combined_Q.begin(), combined_Q.end(), combined_Q_reference.begin()));
+    }
+
+    BOOST_FIXTURE_TEST_CASE(lpc_dfs_lde_store_test, test_fixture) {
+        typedef algebra::curves::bls12<381> curve_type;
+        typedef typename curve_type::scalar_field_type FieldType;
+
+        typedef hashes::sha2<256> merkle_hash_type;
+        typedef hashes::sha2<256> transcript_hash_type;
+
+        constexpr static const std::size_t lambda = 10;
+        constexpr static const std::size_t d = 16;
+        constexpr static const std::size_t m = 2;
+
+        typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+        typedef zk::commitments::
+        list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m>
+                lpc_params_type;
+        typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+        std::size_t degree_log = std::ceil(std::log2(d - 1));
+        typename fri_type::params_type fri_params(
+                1, /*max_step*/
+                degree_log,
+                lambda,
+                2 //expand_factor
+                );
+
+        using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type>;
+
+        auto batch_0 = generate_random_polynomial_dfs_batch<FieldType>(4, d, test_global_alg_rnd_engine<FieldType>);
+        auto batch_1 = generate_random_polynomial_dfs_batch<FieldType>(3, d, test_global_alg_rnd_engine<FieldType>);
+        const std::size_t batch_0_bytes = 4 * fri_params.D[0]->size() * sizeof(typename FieldType::value_type);
+        auto point = algebra::fields::arithmetic_params<FieldType>::multiplicative_generator;
+
+        // The limit of the second configuration keeps batch 0 in memory and spills batch 1.
+        std::vector<std::pair<std::size_t, std::string>> configurations = {
+            {0, ""}, {std::size_t(1) << 30, ""}, {batch_0_bytes, "."}, {0, "."}};
+
+        std::vector<typename lpc_scheme_type::proof_type> proofs;
+        for (auto const &[memory_limit, spill_directory] : configurations) {
+            lpc_scheme_type lpc_scheme_prover(fri_params);
+            lpc_scheme_prover.get_lde_store().set_memory_limit(memory_limit);
+            lpc_scheme_prover.get_lde_store().set_spill_directory(spill_directory);
+
+            lpc_scheme_prover.append_to_batch(0, batch_0);
+            lpc_scheme_prover.append_to_batch(1, batch_1);
+            lpc_scheme_prover.commit(0);
+            lpc_scheme_prover.commit(1);
+            lpc_scheme_prover.append_eval_point(0, point);
+            lpc_scheme_prover.append_eval_point(1, point);
+
+            auto const &stats = lpc_scheme_prover.get_lde_store().get_statistics();
+            BOOST_CHECK_EQUAL(stats.batches_in_memory + stats.batches_spilled + stats.batches_dropped,
+                              lpc_scheme_prover.get_lde_store().enabled() ? 2 : 0);
+
+            // The rows read for the queries are the same as in the whole kept batch.
+            if (lpc_scheme_prover.get_lde_store().contains(1)) {
+                std::vector<std::size_t> rows = {0, 5, fri_params.D[0]->size() - 1};
+                auto batch = lpc_scheme_prover.get_lde_store().get(1);
+                auto values = lpc_scheme_prover.get_lde_store().get_rows(1, rows);
+                BOOST_CHECK_EQUAL(values.size(), batch->size());
+                for (std::size_t i = 0; i < values.size(); i++) {
+                    for (std::size_t j = 0; j < rows.size(); j++) {
+                        BOOST_CHECK(values[i][j] == (*batch)[i][rows[j]]);
+                    }
+                }
+                // Spilled batches are only read back on request.
+                auto resident = lpc_scheme_prover.get_lde_store().get_in_memory(1);
+                BOOST_CHECK_EQUAL(resident == nullptr, stats.batches_spilled != 0);
+            }
+
+            std::array<std::uint8_t, 96> x_data{};
+            zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(x_data);
+            proofs.push_back(lpc_scheme_prover.proof_eval(transcript));
+        }
+
+        for (std::size_t i = 1; i < proofs.size(); i++) {
+            BOOST_CHECK(proofs[i] == proofs[0]);
+        }
+    }
+
+    BOOST_FIXTURE_TEST_CASE(lpc_dfs_eval_polys_peak_memory_test, test_fixture,
+                            *boost::unit_test::precondition(peak_rss_can_be_reset)) {
+        typedef algebra::curves::bls12<381> curve_type;
+        typedef typename curve_type::scalar_field_type FieldType;
+
+        typedef hashes::sha2<256> merkle_hash_type;
+        typedef hashes::sha2<256> transcript_hash_type;
+
+        constexpr static const std::size_t lambda = 10;
+        constexpr static const std::size_t d = 1 << 13;
+        constexpr static const std::size_t m = 2;
+        constexpr static const std::size_t batch_size = 16;
+
+        typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+        typedef zk::commitments::
+        list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m>
+                lpc_params_type;
+        typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+        std::size_t degree_log = std::ceil(std::log2(d - 1));
+        typename fri_type::params_type fri_params(
+                1, /*max_step*/
+                degree_log,
+                lambda,
+                2 //expand_factor
+                );
+
+        using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type>;
+        lpc_scheme_type lpc_scheme_prover(fri_params);
+
+        auto polys = generate_random_polynomial_dfs_batch<FieldType>(
+                batch_size, d, test_global_alg_rnd_engine<FieldType>);
+
+        // The bound is relative to what a copy of one batch costs here, so that neither the page size
+        // nor the allocator caching freed memory changes the outcome.
+        BOOST_REQUIRE(reset_peak_rss());
+        std::size_t rss_before = read_process_memory_counter("VmRSS");
+        {
+            auto polys_copy = polys;
+        }
+        const std::size_t batch_copy_growth = read_process_memory_counter("VmHWM") - rss_before;
+
+        lpc_scheme_prover.append_to_batch(0, polys);
+        lpc_scheme_prover.append_to_batch(1, polys);
+        polys.clear();
+        polys.shrink_to_fit();
+
+        lpc_scheme_prover.commit(0);
+        lpc_scheme_prover.commit(1);
+
+        auto point = algebra::fields::arithmetic_params<FieldType>::multiplicative_generator;
+        lpc_scheme_prover.append_eval_point(0, point);
+        lpc_scheme_prover.append_eval_point(1, point);
+        lpc_scheme_prover.append_eval_point(1, point * point);
+
+        BOOST_REQUIRE(reset_peak_rss());
+        rss_before = read_process_memory_counter("VmRSS");
+
+        std::array<std::uint8_t, 96> x_data{};
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(x_data);
+        lpc_scheme_prover.eval_polys_and_add_roots_to_transcipt(transcript);
+
+        // Polynomials must be evaluated in place: the batches are not copied, only the barycentric weights
+        // of the two points are allocated.
+        const std::size_t peak_growth = read_process_memory_counter("VmHWM") - rss_before;
+        BOOST_TEST_MESSAGE("Peak RSS growth: " << peak_growth << " bytes, batch copy: " << batch_copy_growth);
+        BOOST_CHECK_LT(peak_growth, batch_copy_growth / 2);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(lpc_params_test_suite)
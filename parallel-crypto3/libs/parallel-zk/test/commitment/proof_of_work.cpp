@@ -95,4 +95,64 @@ BOOST_AUTO_TEST_SUITE(proof_of_knowledge_test_suite)
         BOOST_ASSERT(!hard_pow_type::verify(old_transcript_1, result, grinding_bits));
     }
 
+    BOOST_AUTO_TEST_CASE(pow_midstate_test) {
+        using curve_type = curves::pallas;
+        using field_type = curve_type::base_field_type;
+        using keccak = nil::crypto3::hashes::keccak_1600<512>;
+        using transcript_type = nil::crypto3::zk::transcript::fiat_shamir_heuristic_sequential<keccak>;
+        using pow_type = nil::crypto3::zk::commitments::proof_of_work<keccak, std::uint32_t>;
+        using field_pow_type = nil::crypto3::zk::commitments::field_proof_of_work<keccak, field_type>;
+
+        transcript_type transcript;
+        transcript(pow_type::to_byte_array(0x12345678));
+        const auto midstate = transcript.midstate();
+
+        for (std::uint32_t nonce = 0; nonce < 16; ++nonce) {
+            transcript_type tmp_transcript = transcript;
+            tmp_transcript(pow_type::to_byte_array(nonce));
+            BOOST_CHECK_EQUAL(
+                tmp_transcript.int_challenge<std::uint32_t>(),
+                transcript_type::int_challenge_from_midstate<std::uint32_t>(midstate, pow_type::to_byte_array(nonce)));
+
+            typename field_type::value_type element(nonce);
+            tmp_transcript = transcript;
+            tmp_transcript(element);
+            BOOST_CHECK(tmp_transcript.challenge<field_type>() ==
+                        transcript_type::challenge_from_midstate<field_type>(midstate, element));
+        }
+
+        nil::crypto3::zk::commitments::detail::grinding_statistics stats;
+        auto old_transcript = transcript;
+        auto result = field_pow_type::generate(transcript, 8, &stats);
+        BOOST_CHECK(field_pow_type::verify(old_transcript, result, 8));
+        BOOST_CHECK(stats.hashes >= 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(pow_batch_test) {
+        using keccak = nil::crypto3::hashes::keccak_1600<256>;
+        using transcript_type = nil::crypto3::zk::transcript::fiat_shamir_heuristic_sequential<keccak>;
+        using pow_type = nil::crypto3::zk::commitments::proof_of_work<keccak, std::uint32_t>;
+
+        transcript_type transcript;
+        transcript(pow_type::to_byte_array(0x12345678));
+        const auto midstate = transcript.midstate();
+
+        std::array<std::array<std::uint8_t, sizeof(std::uint32_t)>, pow_type::GRINDING_LANES> nonces;
+        for (std::size_t i = 0; i < nonces.size(); ++i) {
+            nonces[i] = pow_type::to_byte_array(static_cast<std::uint32_t>(0xfffffffc + i));
+        }
+        const auto challenges = transcript.int_challenges_batch<std::uint32_t>(nonces);
+        for (std::size_t i = 0; i < nonces.size(); ++i) {
+            BOOST_CHECK_EQUAL(challenges[i],
+                              transcript_type::int_challenge_from_midstate<std::uint32_t>(midstate, nonces[i]));
+        }
+
+        nil::crypto3::zk::commitments::detail::grinding_statistics stats;
+        auto old_transcript = transcript;
+        auto result = pow_type::generate(transcript, 12, &stats);
+        BOOST_CHECK(pow_type::verify(old_transcript, result, 12));
+        BOOST_CHECK(stats.hashes >= pow_type::GRINDING_LANES);
+        BOOST_CHECK_EQUAL(stats.hashes % pow_type::GRINDING_LANES, 0);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -28,6 +28,7 @@
 #include <random>
 #include <iostream>
 #include <set>
+#include <algorithm>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -39,6 +40,7 @@
 #include <nil/crypto3/zk/math/expression.hpp>
 #include <nil/crypto3/zk/math/expression_visitors.hpp>
 #include <nil/crypto3/zk/math/expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/compiled_expression.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
 
 using namespace nil::crypto3;
@@ -158,4 +160,53 @@ BOOST_AUTO_TEST_CASE(expression_for_each_variable_visitor_test) {
         expected_rotations.begin(), expected_rotations.end());
 }
 
+BOOST_AUTO_TEST_CASE(compiled_expression_evaluation_test) {
+
+    // setup
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using variable_type = typename nil::crypto3::zk::snark::plonk_variable<typename FieldType::value_type>;
+    using value_type = typename variable_type::assignment_type;
+
+    variable_type w0(0, 0, variable_type::column_type::witness);
+    variable_type w1(3, -1, variable_type::column_type::public_input);
+    variable_type w2(4, 1, variable_type::column_type::public_input);
+    variable_type w3(6, 2, variable_type::column_type::constant);
+
+    // (w0 + w1) and (w2 + w3) appear several times and must be computed only once.
+    expression<variable_type> expr = (w0 + w1) * (w2 + w3) - w1 * (w2 + w3) + (w0 + w1).pow(3) * 5 +
+                                     w3 * w2 * w0 - 7;
+
+    compiled_expression<variable_type> program(expr);
+    BOOST_CHECK_EQUAL(program.variables().size(), 4);
+
+    const std::size_t rows = 100;
+    std::vector<std::vector<value_type>> columns_values(program.variables().size());
+    std::vector<const value_type*> columns;
+    for (std::size_t i = 0; i < columns_values.size(); ++i) {
+        for (std::size_t j = 0; j < rows; ++j) {
+            columns_values[i].push_back(value_type(3 * j + 7 * i + 1));
+        }
+        columns.push_back(columns_values[i].data());
+    }
+
+    // Odd bounds and block sizes check the partial blocks.
+    const std::size_t begin = 3;
+    for (std::size_t block_size : {1, 7, 64, 200}) {
+        std::vector<value_type> result(rows - begin);
+        program.evaluate(columns, begin, rows, result.data(), block_size);
+
+        for (std::size_t j = begin; j < rows; ++j) {
+            expression_evaluator<variable_type> evaluator(
+                expr,
+                [&program, &columns_values, j](const variable_type& var) -> const value_type& {
+                    const auto& vars = program.variables();
+                    return columns_values[std::find(vars.begin(), vars.end(), var) - vars.begin()][j];
+                }
+            );
+            BOOST_CHECK(result[j - begin] == evaluator.evaluate());
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
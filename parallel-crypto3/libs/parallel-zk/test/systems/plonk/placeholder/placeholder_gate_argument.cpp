@@ -228,4 +228,79 @@ BOOST_AUTO_TEST_SUITE(placeholder_gate_argument)
         BOOST_CHECK(prover_res[0].evaluate(y) == verifier_res[0]);
     }
 
+    BOOST_FIXTURE_TEST_CASE(placeholder_gate_argument_lde_values_test, test_tools::random_test_initializer<field_type>) {
+        auto pi0 = alg_random_engines.template get_alg_engine<field_type>()();
+        auto circuit = circuit_test_t<field_type>(
+                pi0,
+                alg_random_engines.template get_alg_engine<field_type>(),
+                generic_random_engine
+        );
+
+        plonk_table_description<field_type> desc(
+                circuit.table.witnesses().size(),
+                circuit.table.public_inputs().size(),
+                circuit.table.constants().size(),
+                circuit.table.selectors().size(),
+                circuit.usable_rows,
+                circuit.table_rows);
+
+        std::size_t table_rows_log = std::log2(desc.rows_amount);
+
+        typename policy_type::constraint_system_type constraint_system(
+                circuit.gates, circuit.copy_constraints, circuit.lookup_gates);
+        typename policy_type::variable_assignment_type assignments = circuit.table;
+
+        typename lpc_type::fri_type::params_type fri_params(1, table_rows_log, placeholder_test_params::lambda, 4);
+        lpc_scheme_type lpc_scheme(fri_params);
+
+        typename placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
+                preprocessed_public_data = placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::process(
+                constraint_system, assignments.public_table(), desc, lpc_scheme
+        );
+
+        typename placeholder_private_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
+                preprocessed_private_data = placeholder_private_preprocessor<field_type, lpc_placeholder_params_type>::process(
+                constraint_system, assignments.private_table(), desc
+        );
+
+        auto polynomial_table =
+                plonk_polynomial_dfs_table<field_type>(
+                        preprocessed_private_data.private_polynomial_table,
+                        preprocessed_public_data.public_polynomial_table);
+
+        // The variable columns extended to D[0] the same way the prover's commitment keeps them.
+        lpc_scheme_type variable_values_lpc(fri_params);
+        variable_values_lpc.get_lde_store().set_memory_limit(std::size_t(1) << 30);
+        variable_values_lpc.append_to_batch(0, polynomial_table.witnesses());
+        variable_values_lpc.append_to_batch(0, polynomial_table.public_inputs());
+        variable_values_lpc.commit(0);
+        auto variable_values_lde = variable_values_lpc.get_lde_store().get(0);
+        BOOST_CHECK(variable_values_lde != nullptr);
+
+        math::polynomial_dfs<typename field_type::value_type> mask_polynomial(
+                0, preprocessed_public_data.common_data.basic_domain->m,
+                typename field_type::value_type(1)
+        );
+        mask_polynomial -= preprocessed_public_data.q_last;
+        mask_polynomial -= preprocessed_public_data.q_blind;
+
+        std::vector<std::uint8_t> init_blob{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        transcript_type transcript(init_blob);
+        transcript_type lde_transcript(init_blob);
+
+        auto prover_res = placeholder_gates_argument<field_type, lpc_placeholder_params_type>::prove_eval(
+                constraint_system, polynomial_table, preprocessed_public_data.common_data.basic_domain,
+                preprocessed_public_data.common_data.max_gates_degree,
+                mask_polynomial, preprocessed_public_data.common_data.lagrange_0,
+                transcript
+        );
+        auto lde_prover_res = placeholder_gates_argument<field_type, lpc_placeholder_params_type>::prove_eval(
+                constraint_system, polynomial_table, preprocessed_public_data.common_data.basic_domain,
+                preprocessed_public_data.common_data.max_gates_degree,
+                mask_polynomial, preprocessed_public_data.common_data.lagrange_0,
+                lde_transcript, variable_values_lde.get()
+        );
+        BOOST_CHECK(prover_res[0] == lde_prover_res[0]);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
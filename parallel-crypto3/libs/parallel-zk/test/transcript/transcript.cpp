@@ -38,6 +38,9 @@
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/mnt6.hpp>
 #include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
+#include <nil/crypto3/algebra/fields/fp2.hpp>
+#include <nil/crypto3/algebra/fields/fp3.hpp>
 
 #include <nil/crypto3/hash/block_to_field_elements_wrapper.hpp>
 #include <nil/crypto3/hash/poseidon.hpp>
@@ -70,6 +73,27 @@ BOOST_AUTO_TEST_CASE(zk_transcript_manual_test) {
     BOOST_CHECK_EQUAL(ch_n[2].data, field_type::value_type(0x10bfe2f4a414eec551dda5fd9899e9b46e327648b4fa564ed0517b6a99396aec_cppui_modular254).data);
 }
 
+// Extension field challenges are the consecutive base field challenges.
+BOOST_AUTO_TEST_CASE(zk_transcript_extension_field_test) {
+    using field_type = algebra::fields::goldilocks64;
+    using fp2_type = algebra::fields::fp2<field_type>;
+    using fp3_type = algebra::fields::fp3<field_type>;
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    transcript::fiat_shamir_heuristic_sequential<hashes::keccak_1600<256>> tr(init_blob);
+    transcript::fiat_shamir_heuristic_sequential<hashes::keccak_1600<256>> tr_base(init_blob);
+
+    auto ch2 = tr.challenge<fp2_type>();
+    auto ch3 = tr.challenge<fp3_type>();
+    auto base = tr_base.challenges<field_type, 5>();
+
+    BOOST_CHECK(ch2.data[0] == base[0]);
+    BOOST_CHECK(ch2.data[1] == base[1]);
+    BOOST_CHECK(ch3.data[0] == base[2]);
+    BOOST_CHECK(ch3.data[1] == base[3]);
+    BOOST_CHECK(ch3.data[2] == base[4]);
+    BOOST_CHECK(tr.int_challenge<std::size_t>() == tr_base.int_challenge<std::size_t>());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
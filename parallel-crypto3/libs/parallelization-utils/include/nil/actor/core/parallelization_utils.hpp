@@ -25,17 +25,26 @@
 #ifndef CRYPTO3_PARALLELIZATION_UTILS_HPP
 #define CRYPTO3_PARALLELIZATION_UTILS_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
 #include <future>
+#include <iterator>
+#include <vector>
 
 #include <nil/actor/core/thread_pool.hpp>
 
 namespace nil {
     namespace crypto3 {
 
+        // When called from a task, the waiting thread runs the tasks it posted until the futures are ready,
+        // so the tasks can be nested at any depth, see ThreadPool::wait.
         template<class ReturnType>
         std::vector<ReturnType> wait_for_all(std::vector<std::future<ReturnType>> futures) {
             std::vector<ReturnType> results;
             for (auto& f: futures) {
+                ThreadPool::wait(f);
                 results.push_back(f.get());
             }
             return results;
@@ -43,10 +52,119 @@ namespace nil {
 
         inline void wait_for_all(std::vector<std::future<void>> futures) {
             for (auto& f: futures) {
+                ThreadPool::wait(f);
                 f.get();
             }
         }
 
+        namespace detail {
+            // Number of chunks the work of 'elements_count' elements is divided into.
+            inline std::size_t chunks_count(std::size_t elements_count, ThreadPool::PoolLevel pool_id) {
+                auto& thread_pool = ThreadPool::get_instance(pool_id);
+                std::size_t workers_to_use = std::max((size_t)1, std::min(elements_count, thread_pool.get_pool_size()));
+
+                // For LOW level tasks we have experimentally found that operations over chunks of <4096 elements
+                // do not load the cores. In case we have smaller chunks, it's better to load less cores.
+                static constexpr std::size_t POOL_0_MIN_CHUNK_SIZE = 1 << 12;
+
+                // LOW level is used for the lowest level of operations, like polynomial operations.
+                // We want the minimal size of elements_per_worker to be 'POOL_0_MIN_CHUNK_SIZE', otherwise the cores are not loaded.
+                if (pool_id == ThreadPool::PoolLevel::LOW && elements_count / workers_to_use < POOL_0_MIN_CHUNK_SIZE) {
+                    workers_to_use = elements_count / POOL_0_MIN_CHUNK_SIZE + ((elements_count % POOL_0_MIN_CHUNK_SIZE) ? 1 : 0);
+                    workers_to_use = std::max((size_t)1, workers_to_use);
+                }
+                return workers_to_use;
+            }
+
+            // State shared by the chunks of one 'parallel_for_chunks_with_thread_id' call.
+            struct chunks_state {
+                explicit chunks_state(std::size_t count) : done(count) {
+                }
+
+                latch done;
+                std::atomic<bool> failed{false};
+                std::exception_ptr error;
+            };
+
+            template<class Func>
+            struct chunk_job {
+                const Func* func;
+                std::size_t thread_id;
+                std::size_t begin;
+                std::size_t end;
+                chunks_state* state;
+
+                static void run(void* data) {
+                    chunk_job& job = *static_cast<chunk_job*>(data);
+                    try {
+                        (*job.func)(job.thread_id, job.begin, job.end);
+                    } catch (...) {
+                        // Only the first exception is kept.
+                        if (!job.state->failed.exchange(true))
+                            job.state->error = std::current_exception();
+                    }
+                    job.state->done.count_down();
+                }
+            };
+        }    // namespace detail
+
+        // Divides work into chunks and calls func(thread_id, begin, end) on them in parallel, returns when all the
+        // chunks are done. Unlike 'parallel_run_in_chunks', 'func' is not wrapped into std::function and nothing is
+        // allocated for up to 64 chunks. The calling thread processes the last chunk itself.
+        // The first exception thrown by 'func' is rethrown after all the chunks are finished.
+        template<class Func>
+        void parallel_for_chunks_with_thread_id(
+                std::size_t elements_count, const Func& func,
+                ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+
+            const std::size_t workers_to_use = detail::chunks_count(elements_count, pool_id);
+            if (workers_to_use == 1) {
+                func(0, 0, elements_count);
+                return;
+            }
+
+            static constexpr std::size_t LOCAL_JOBS = 64;
+            std::array<detail::chunk_job<Func>, LOCAL_JOBS> local_jobs;
+            std::vector<detail::chunk_job<Func>> heap_jobs;
+            detail::chunk_job<Func>* jobs = local_jobs.data();
+            if (workers_to_use > LOCAL_JOBS) {
+                heap_jobs.resize(workers_to_use);
+                jobs = heap_jobs.data();
+            }
+
+            auto& thread_pool = ThreadPool::get_instance(pool_id);
+            detail::chunks_state state(workers_to_use);
+            // The chunk run by the caller may hold a lock the other chunks take, the nested calls in it must not
+            // steal them while waiting.
+            ThreadPool::region_scope scope(&state);
+
+            std::size_t begin = 0;
+            for (std::size_t i = 0; i < workers_to_use; i++) {
+                auto end = begin + (elements_count - begin) / (workers_to_use - i);
+                jobs[i] = {&func, i, begin, end, &state};
+                if (i + 1 < workers_to_use)
+                    thread_pool.submit({&detail::chunk_job<Func>::run, &jobs[i], &state});
+                begin = end;
+            }
+            detail::chunk_job<Func>::run(&jobs[workers_to_use - 1]);
+
+            thread_pool.wait_until([&state]() { return state.done.try_wait(); }, &state);
+            if (state.error)
+                std::rethrow_exception(state.error);
+        }
+
+        // Same as 'parallel_for_chunks_with_thread_id', func is called as func(begin, end).
+        template<class Func>
+        void parallel_for_chunks(
+                std::size_t elements_count, const Func& func,
+                ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+            parallel_for_chunks_with_thread_id(
+                elements_count,
+                [&func](std::size_t thread_id, std::size_t begin, std::size_t end) {
+                    func(begin, end);
+                }, pool_id);
+        }
+
         // Divides work into chunks and makes calls to 'func' in parallel.
         template<class ReturnType>
         std::vector<std::future<ReturnType>> parallel_run_in_chunks_with_thread_id(
@@ -57,18 +175,7 @@ namespace nil {
             auto& thread_pool = ThreadPool::get_instance(pool_id);
 
             std::vector<std::future<ReturnType>> fut;
-            std::size_t workers_to_use = std::max((size_t)1, std::min(elements_count, thread_pool.get_pool_size()));
-
-            // For pool #0 we have experimentally found that operations over chunks of <4096 elements
-            // do not load the cores. In case we have smaller chunks, it's better to load less cores.
-            static constexpr std::size_t POOL_0_MIN_CHUNK_SIZE = 1 << 12;
-
-            // Pool #0 will take care of the lowest level of operations, like polynomial operations.
-            // We want the minimal size of elements_per_worker to be 'POOL_0_MIN_CHUNK_SIZE', otherwise the cores are not loaded.
-            if (pool_id == ThreadPool::PoolLevel::LOW && elements_count / workers_to_use < POOL_0_MIN_CHUNK_SIZE) {
-                workers_to_use = elements_count / POOL_0_MIN_CHUNK_SIZE + ((elements_count % POOL_0_MIN_CHUNK_SIZE) ? 1 : 0);
-                workers_to_use = std::max((size_t)1, workers_to_use);
-            }
+            const std::size_t workers_to_use = detail::chunks_count(elements_count, pool_id);
 
             std::size_t begin = 0;
             for (std::size_t i = 0; i < workers_to_use; i++) {
@@ -98,20 +205,19 @@ namespace nil {
                                 OutputIt d_first, BinaryOperation binary_op,
                                 ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
 
-            wait_for_all(parallel_run_in_chunks<void>(
+            parallel_for_chunks(
                 std::distance(first1, last1),
-                // We need the lambda to be mutable, to be able to modify iterators captured by value.
-                [first1, last1, first2, d_first, binary_op](std::size_t begin, std::size_t end) mutable {
-                    std::advance(first1, begin);
-                    std::advance(first2, begin);
-                    std::advance(d_first, begin);
-                    for (std::size_t i = begin; i < end && first1 != last1; i++) {
-                        *d_first = binary_op(*first1, *first2);
-                        ++first1;
-                        ++first2;
-                        ++d_first;
+                [first1, first2, d_first, &binary_op](std::size_t begin, std::size_t end) {
+                    auto in1 = std::next(first1, begin);
+                    auto in2 = std::next(first2, begin);
+                    auto out = std::next(d_first, begin);
+                    for (std::size_t i = begin; i < end; i++) {
+                        *out = binary_op(*in1, *in2);
+                        ++in1;
+                        ++in2;
+                        ++out;
                     }
-                }, pool_id));
+                }, pool_id);
         }
 
         // Similar to std::transform, but in parallel. We return void here for better usability for our use cases.
@@ -120,18 +226,17 @@ namespace nil {
                                 OutputIt d_first, UnaryOperation unary_op,
                                 ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
 
-            wait_for_all(parallel_run_in_chunks<void>(
+            parallel_for_chunks(
                 std::distance(first1, last1),
-                // We need the lambda to be mutable, to be able to modify iterators captured by value.
-                [first1, last1, d_first, unary_op](std::size_t begin, std::size_t end) mutable {
-                    std::advance(first1, begin);
-                    std::advance(d_first, begin);
-                    for (std::size_t i = begin; i < end && first1 != last1; i++) {
-                        *d_first = unary_op(*first1);
-                        ++first1;
-                        ++d_first;
+                [first1, d_first, &unary_op](std::size_t begin, std::size_t end) {
+                    auto in = std::next(first1, begin);
+                    auto out = std::next(d_first, begin);
+                    for (std::size_t i = begin; i < end; i++) {
+                        *out = unary_op(*in);
+                        ++in;
+                        ++out;
                     }
-                }, pool_id));
+                }, pool_id);
         }
 
         // This one is an optimization, since copying field elements is quite slow.
@@ -141,18 +246,17 @@ namespace nil {
                                          BinaryOperation binary_op,
                                          ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
 
-            wait_for_all(parallel_run_in_chunks<void>(
+            parallel_for_chunks(
                 std::distance(first1, last1),
-                // We need the lambda to be mutable, to be able to modify iterators captured by value.
-                [first1, last1, first2, binary_op](std::size_t begin, std::size_t end) mutable {
-                    std::advance(first1, begin);
-                    std::advance(first2, begin);
-                    for (std::size_t i = begin; i < end && first1 != last1; i++) {
-                        binary_op(*first1, *first2);
-                        ++first1;
-                        ++first2;
+                [first1, first2, &binary_op](std::size_t begin, std::size_t end) {
+                    auto in1 = std::next(first1, begin);
+                    auto in2 = std::next(first2, begin);
+                    for (std::size_t i = begin; i < end; i++) {
+                        binary_op(*in1, *in2);
+                        ++in1;
+                        ++in2;
                     }
-                }, pool_id));
+                }, pool_id);
         }
 
         // This one is an optimization, since copying field elements is quite slow.
@@ -161,28 +265,80 @@ namespace nil {
         void parallel_foreach(InputIt first1, InputIt last1, UnaryOperation unary_op,
                               ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
 
-            wait_for_all(parallel_run_in_chunks<void>(
+            parallel_for_chunks(
                 std::distance(first1, last1),
-                // We need the lambda to be mutable, to be able to modify iterators captured by value.
-                [first1, last1, unary_op](std::size_t begin, std::size_t end) mutable {
-                    std::advance(first1, begin);
-                    for (std::size_t i = begin; i < end && first1 != last1; i++) {
-                        unary_op(*first1);
-                        ++first1;
+                [first1, &unary_op](std::size_t begin, std::size_t end) {
+                    auto in = std::next(first1, begin);
+                    for (std::size_t i = begin; i < end; i++) {
+                        unary_op(*in);
+                        ++in;
                     }
-                }, pool_id));
+                }, pool_id);
         }
 
         // Calls function func for each value between [start, end).
-        inline void parallel_for(std::size_t start, std::size_t end, std::function<void(std::size_t index)> func,
-                                 ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
-            wait_for_all(parallel_run_in_chunks<void>(
+        template<class Func>
+        void parallel_for(std::size_t start, std::size_t end, const Func& func,
+                          ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+            parallel_for_chunks(
                 end - start,
-                [start, func](std::size_t range_begin, std::size_t range_end) {
+                [start, &func](std::size_t range_begin, std::size_t range_end) {
                     for (std::size_t i = start + range_begin; i < start + range_end; i++) {
                         func(i);
                     }
-                }, pool_id));
+                }, pool_id);
+        }
+
+        // Replaces the values in [first, last) with their inclusive prefix scan: first[i] = first[0] op ... op first[i].
+        // 'op' must be associative, but not necessarily commutative. Each chunk is scanned in parallel,
+        // then the running value of all the preceding chunks is applied to the elements of every chunk.
+        template<class RandomIt, class BinaryOperation>
+        void parallel_inclusive_scan(RandomIt first, RandomIt last, BinaryOperation op,
+                                     ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+            using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+            const std::size_t elements_count = std::distance(first, last);
+            if (elements_count == 0) {
+                return;
+            }
+
+            // Pass 1: scan every chunk locally, remember where it starts.
+            std::vector<std::size_t> chunk_begins(detail::chunks_count(elements_count, pool_id));
+            parallel_for_chunks_with_thread_id(
+                elements_count,
+                [first, &op, &chunk_begins](std::size_t thread_id, std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin + 1; i < end; ++i) {
+                        first[i] = op(first[i - 1], first[i]);
+                    }
+                    chunk_begins[thread_id] = begin;
+                }, pool_id);
+
+            if (chunk_begins.size() == 1) {
+                return;
+            }
+
+            // carries[c] is the scan value right before chunk c, chunk 0 has none.
+            std::vector<value_type> carries(chunk_begins.size());
+            carries[1] = first[chunk_begins[1] - 1];
+            for (std::size_t c = 2; c < chunk_begins.size(); ++c) {
+                carries[c] = op(carries[c - 1], first[chunk_begins[c] - 1]);
+            }
+
+            // Pass 2: apply the carries. The ranges given here don't need to match the chunks of pass 1.
+            parallel_for_chunks(
+                elements_count,
+                [first, &op, &chunk_begins, &carries](std::size_t begin, std::size_t end) {
+                    std::size_t c = std::upper_bound(chunk_begins.begin(), chunk_begins.end(), begin) -
+                                    chunk_begins.begin() - 1;
+                    for (std::size_t i = begin; i < end; ++i) {
+                        if (c + 1 < chunk_begins.size() && i == chunk_begins[c + 1]) {
+                            ++c;
+                        }
+                        if (c != 0) {
+                            first[i] = op(carries[c], first[i]);
+                        }
+                    }
+                }, pool_id);
         }
 
     }        // namespace crypto3
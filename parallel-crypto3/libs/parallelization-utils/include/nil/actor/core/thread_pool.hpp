@@ -25,62 +25,245 @@
 #ifndef CRYPTO3_THREAD_POOL_HPP
 #define CRYPTO3_THREAD_POOL_HPP
 
-#include <boost/asio/thread_pool.hpp>
-#include <boost/asio/post.hpp>
-
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
 #include <functional>
 #include <future>
 #include <thread>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 
 namespace nil {
     namespace crypto3 {
 
+        // Counts the tasks which are not finished yet, the submitter waits for it to reach zero.
+        class latch {
+        public:
+            explicit latch(std::size_t count) : counter(count) {
+            }
+
+            latch(const latch& obj) = delete;
+            latch& operator=(const latch& obj) = delete;
+
+            void count_down() {
+                counter.fetch_sub(1, std::memory_order_release);
+            }
+
+            bool try_wait() const {
+                return counter.load(std::memory_order_acquire) == 0;
+            }
+
+        private:
+            std::atomic<std::size_t> counter;
+        };
+
+        /** Work-stealing thread pool.
+         *  Every worker has its own queue: tasks posted by a worker go to its own queue and are taken from its back,
+         *  idle workers steal from the front of the other queues. Tasks posted from outside go to a shared queue.
+         *  A thread waiting for its tasks keeps running them meanwhile, so tasks can post and wait for other tasks
+         *  (fork/join) with no risk of a deadlock. A waiting thread runs the tasks it waits for first, then steals
+         *  the other ones, except the tasks of the regions it is in the middle of, see 'wait_until'.
+         */
         class ThreadPool {
         public:
 
+            // The levels are kept for compatibility, all of them refer to the same pool now.
             enum class PoolLevel {
                 LOW,
                 HIGH,
                 LASTPOOL
             };
 
-            /** Returns a thread pool, based on the pool_id. pool with LOW is normally used for low-level operations, like polynomial
-             *  operations and fft. Any code that uses these operations and needs to be parallel will submit its tasks to pool with HIGH.
-             *  Submission of higher level tasks to low level pool will immediately result in a deadlock.
+            // Environment variable which limits the number of worker threads.
+            static constexpr const char* THREADS_ENV_VARIABLE = "NIL_CRYPTO3_THREADS";
+
+            /** Returns the thread pool. All the levels share the same workers, so low level operations, like
+             *  polynomial operations and fft, can be called from inside higher level tasks.
+             *  The pool is created on the first call, with 'pool_size' threads, or if it is 0 with the number of
+             *  threads set by 'configure', or with 'default_pool_size()'.
              */
-            static ThreadPool& get_instance(PoolLevel pool_id, std::size_t pool_size = std::thread::hardware_concurrency()) {
-                static ThreadPool instance_for_low_level(pool_size);
-                static ThreadPool instance_for_middle_level(pool_size);
-                static ThreadPool instance_for_high_level(pool_size);
-                
-                if (pool_id == PoolLevel::LOW)
-                    return instance_for_low_level;
-                if (pool_id == PoolLevel::HIGH)
-                    return instance_for_middle_level;
-                if (pool_id == PoolLevel::LASTPOOL)
-                    return instance_for_high_level;
+            static ThreadPool& get_instance(PoolLevel pool_id, std::size_t pool_size = 0) {
+                if (pool_id != PoolLevel::LOW && pool_id != PoolLevel::HIGH && pool_id != PoolLevel::LASTPOOL)
+                    throw std::invalid_argument("Invalid instance of thread pool requested.");
+
+                static ThreadPool instance(creation_pool_size(pool_size));
+                return instance;
+            }
 
-                throw std::invalid_argument("Invalid instance of thread pool requested.");
+            /** Sets the number of threads of the pool, 0 for 'default_pool_size()'. Must be called before the pool
+             *  is used. Returns false if the pool is already created, its number of threads does not change then.
+             */
+            static bool configure(std::size_t pool_size) {
+                auto& config = configuration();
+                std::lock_guard<std::mutex> lock(config.mutex);
+                if (config.created)
+                    return false;
+                config.pool_size = pool_size;
+                return true;
+            }
+
+            /** Number of threads used by default: the value of NIL_CRYPTO3_THREADS if it is set to a positive
+             *  number, std::thread::hardware_concurrency() otherwise.
+             */
+            static std::size_t default_pool_size() {
+                const char* env_value = std::getenv(THREADS_ENV_VARIABLE);
+                if (env_value != nullptr) {
+                    try {
+                        long long threads = std::stoll(env_value);
+                        if (threads > 0)
+                            return static_cast<std::size_t>(threads);
+                    } catch (const std::exception&) {
+                    }
+                }
+                return std::max(1u, std::thread::hardware_concurrency());
             }
 
             ThreadPool(const ThreadPool& obj)= delete;
             ThreadPool& operator=(const ThreadPool& obj)= delete;
 
+            ~ThreadPool() {
+                {
+                    std::lock_guard<std::mutex> lock(sleep_mutex);
+                    stopping = true;
+                }
+                sleep_cv.notify_all();
+                for (auto& worker : workers)
+                    worker.join();
+
+                // Tasks submitted while the workers were stopping are never run, release what they own.
+                job task;
+                while (pop_front(shared_queue, task))
+                    discard(task);
+                for (auto& queue : queues) {
+                    while (pop_front(queue, task))
+                        discard(task);
+                }
+            }
+
+            /** A task which is not owned by the pool: 'run(data)' is called once, 'data' must stay alive until then.
+             *  Used to submit work without any allocation, the submitter usually waits on a 'latch' afterwards.
+             *  'region' identifies the tasks a thread waits for, see 'wait_until'. 'release(data)', if set, is
+             *  called instead of 'run' for a task which is never run because the pool is destroyed.
+             */
+            struct job {
+                void (*run)(void*);
+                void* data;
+                const void* region = nullptr;
+                void (*release)(void*) = nullptr;
+            };
+
+            /** Marks the current thread as being in the middle of the work of 'region' while it exists, the thread
+             *  does not steal the tasks of the region while waiting then, see 'wait_until'. Tasks run by the pool
+             *  and waits are marked with their region already.
+             */
+            class region_scope {
+            public:
+                explicit region_scope(const void* region) {
+                    running_regions().push_back(region);
+                }
+
+                region_scope(const region_scope&) = delete;
+                region_scope& operator=(const region_scope&) = delete;
+
+                ~region_scope() {
+                    running_regions().pop_back();
+                }
+            };
+
+            /** Runs the task on the pool. The tasks posted by one thread form a single region, which it may help
+             *  to run while waiting for any of their futures, see 'wait'.
+             */
             template<class ReturnType>
             inline std::future<ReturnType> post(std::function<ReturnType()> task) {
-                auto packaged_task = std::make_shared<std::packaged_task<ReturnType()>>(std::move(task));
+                typedef std::packaged_task<ReturnType()> packaged_task_type;
+
+                auto packaged_task = new packaged_task_type(std::move(task));
                 std::future<ReturnType> fut = packaged_task->get_future();
-                boost::asio::post(pool, [packaged_task]() -> void { (*packaged_task)(); });
+                submit({[](void* data) {
+                            auto task = static_cast<packaged_task_type*>(data);
+                            (*task)();
+                            delete task;
+                        },
+                        packaged_task, posted_region(),
+                        // The future of a task deleted before being run reports a broken promise.
+                        [](void* data) { delete static_cast<packaged_task_type*>(data); }});
                 return fut;
             }
- 
+
+            inline void submit(const job& task) {
+                // Counted before being queued, so the counters never go below the real number of tasks.
+                ++active_tasks;
+                ++queued_tasks;
+                {
+                    task_queue& queue = current_pool() == this ? queues[current_worker_index()] : shared_queue;
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    queue.tasks.push_back(task);
+                }
+                {
+                    // Makes sure a worker going to sleep either sees the task or gets the notification.
+                    std::lock_guard<std::mutex> lock(sleep_mutex);
+                }
+                sleep_cv.notify_one();
+            }
+
+            /** Waits until 'ready()' returns true, running the queued tasks of 'region' meanwhile. Any thread may
+             *  call it, a thread which is not a worker of the pool helps the workers while waiting.
+             *
+             *  The tasks of 'region' submitted by the calling thread are run first. When none of them is left, the
+             *  thread steals the oldest tasks of the shared queue and of the workers, except the tasks of the
+             *  regions it is in the middle of, see 'region_scope': it may hold a lock taken by one of their tasks,
+             *  or be in the middle of the work they wait for, and would deadlock on it. When nothing can be run,
+             *  the thread sleeps until a task of the pool finishes.
+             */
+            template<class Predicate>
+            void wait_until(Predicate ready, const void* region) {
+                region_scope scope(region);
+                while (!ready()) {
+                    if (run_pending_task(region) || run_stolen_task())
+                        continue;
+
+                    // Every finished task notifies the waiting threads. The timeout covers the predicates which
+                    // become true outside of the pool, like a future set by another thread.
+                    ++waiting_threads;
+                    {
+                        std::unique_lock<std::mutex> lock(wait_mutex);
+                        wait_cv.wait_for(lock, std::chrono::milliseconds(1), ready);
+                    }
+                    --waiting_threads;
+                }
+            }
+
+            /** Waits until the future of a posted task is ready, running the tasks posted by the calling thread
+             *  meanwhile. These are the other tasks of the same parallel_run_in_chunks call, or of the previous
+             *  calls the thread did not wait for yet, so no lock may be held while waiting for them.
+             */
+            template<class FutureType>
+            static void wait(const FutureType& fut) {
+                ThreadPool* pool = current_pool();
+                if (pool == nullptr) {
+                    fut.wait();
+                    return;
+                }
+                pool->wait_until(
+                    [&fut]() { return fut.wait_for(std::chrono::seconds(0)) == std::future_status::ready; },
+                    posted_region());
+            }
+
             // Waits for all the tasks to complete.
             inline void join() {
-                pool.join();
+                while (active_tasks.load() != 0) {
+                    if (current_pool() != this || !run_pending_task(nullptr))
+                        std::this_thread::yield();
+                }
             }
 
             std::size_t get_pool_size() const {
@@ -88,14 +271,214 @@ namespace nil {
             }
 
         private:
+            struct task_queue {
+                std::mutex mutex;
+                std::deque<job> tasks;
+            };
+
+            struct configuration_type {
+                std::mutex mutex;
+                std::size_t pool_size = 0;
+                bool created = false;
+            };
+
+            static configuration_type& configuration() {
+                static configuration_type instance;
+                return instance;
+            }
+
+            // Number of threads of the pool being created, 'configure' has no effect from now on.
+            static std::size_t creation_pool_size(std::size_t pool_size) {
+                auto& config = configuration();
+                std::lock_guard<std::mutex> lock(config.mutex);
+                config.created = true;
+                if (pool_size != 0)
+                    return pool_size;
+                return config.pool_size != 0 ? config.pool_size : default_pool_size();
+            }
+
             inline ThreadPool(std::size_t pool_size)
-                : pool(pool_size)
-                , pool_size(pool_size)  {
+                : pool_size(std::max<std::size_t>(1, pool_size))
+                , queues(this->pool_size)  {
+                for (std::size_t i = 0; i < this->pool_size; ++i)
+                    workers.emplace_back([this, i]() { worker_loop(i); });
+            }
+
+            // The pool the current thread works for, nullptr for the threads not created by a pool.
+            static ThreadPool*& current_pool() {
+                static thread_local ThreadPool* pool = nullptr;
+                return pool;
+            }
+
+            static std::size_t& current_worker_index() {
+                static thread_local std::size_t index = 0;
+                return index;
+            }
+
+            // The region of the tasks posted by the current thread.
+            static const void* posted_region() {
+                static thread_local const char region = 0;
+                return &region;
+            }
+
+            // Regions the current thread is in the middle of, the innermost last.
+            static std::vector<const void*>& running_regions() {
+                static thread_local std::vector<const void*> regions;
+                return regions;
+            }
+
+            static void discard(const job& task) {
+                if (task.release != nullptr)
+                    task.release(task.data);
+            }
+
+            bool pop_back(task_queue& queue, job& task) {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty())
+                    return false;
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                return true;
+            }
+
+            bool pop_front(task_queue& queue, job& task) {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty())
+                    return false;
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                return true;
+            }
+
+            // Takes the oldest task which is not of one of the regions the current thread is in the middle of.
+            bool pop_front_stealable(task_queue& queue, job& task) {
+                const auto& running = running_regions();
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                auto it = std::find_if(queue.tasks.begin(), queue.tasks.end(), [&running](const job& queued) {
+                    return std::find(running.begin(), running.end(), queued.region) == running.end();
+                });
+                if (it == queue.tasks.end())
+                    return false;
+                task = *it;
+                queue.tasks.erase(it);
+                return true;
+            }
+
+            // Takes the newest task of 'region' from the queue.
+            bool pop_back(task_queue& queue, const void* region, job& task) {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                auto it = std::find_if(queue.tasks.rbegin(), queue.tasks.rend(),
+                                       [region](const job& queued) { return queued.region == region; });
+                if (it == queue.tasks.rend())
+                    return false;
+                task = *it;
+                queue.tasks.erase(std::next(it).base());
+                return true;
+            }
+
+            /** Runs one task. With no region: the newest one of the own queue, else the oldest shared one, else a
+             *  stolen one. Otherwise the newest task of the region which is still in the queue of the calling
+             *  thread, the tasks of a region are submitted to the own queue of a worker, or to the shared one.
+             */
+            bool run_pending_task(const void* region) {
+                if (queued_tasks.load() == 0)
+                    return false;
+
+                job task;
+                bool found = false;
+                const bool is_worker = current_pool() == this;
+                const std::size_t own_index = is_worker ? current_worker_index() : 0;
+
+                if (region != nullptr) {
+                    found = pop_back(is_worker ? queues[own_index] : shared_queue, region, task);
+                } else {
+                    if (is_worker)
+                        found = pop_back(queues[own_index], task);
+                    if (!found)
+                        found = pop_front(shared_queue, task);
+                    for (std::size_t i = 1; !found && i <= pool_size; ++i)
+                        found = pop_front(queues[(own_index + i) % pool_size], task);
+                }
+                if (!found)
+                    return false;
+
+                run_task(task);
+                return true;
+            }
+
+            /** Runs one task of another thread for a thread which waits and has none of its own tasks left: the
+             *  oldest one of the shared queue, else of the queues of the other workers.
+             */
+            bool run_stolen_task() {
+                if (queued_tasks.load() == 0)
+                    return false;
+
+                job task;
+                const bool is_worker = current_pool() == this;
+                const std::size_t own_index = is_worker ? current_worker_index() : 0;
+
+                bool found = pop_front_stealable(shared_queue, task);
+                for (std::size_t i = 1; !found && i <= pool_size; ++i) {
+                    if (!is_worker || i != pool_size)
+                        found = pop_front_stealable(queues[(own_index + i) % pool_size], task);
+                }
+                if (!found)
+                    return false;
+
+                run_task(task);
+                return true;
+            }
+
+            void run_task(const job& task) {
+                --queued_tasks;
+                {
+                    region_scope scope(task.region);
+                    task.run(task.data);
+                }
+                --active_tasks;
+
+                // Pairs with the increment of 'waiting_threads' in 'wait_until': either the waiting thread sees
+                // the effects of the task, or the notification is sent under the lock it waits with.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (waiting_threads.load() != 0) {
+                    {
+                        std::lock_guard<std::mutex> lock(wait_mutex);
+                    }
+                    wait_cv.notify_all();
+                }
+            }
+
+            void worker_loop(std::size_t index) {
+                current_pool() = this;
+                current_worker_index() = index;
+                while (true) {
+                    if (run_pending_task(nullptr))
+                        continue;
+
+                    std::unique_lock<std::mutex> lock(sleep_mutex);
+                    sleep_cv.wait(lock, [this]() { return stopping || queued_tasks.load() != 0; });
+                    if (stopping && queued_tasks.load() == 0)
+                        return;
+                }
             }
 
-            boost::asio::thread_pool pool;
             const std::size_t pool_size;
+            std::vector<task_queue> queues;
+            task_queue shared_queue;
+            std::vector<std::thread> workers;
+
+            // Tasks in the queues, and tasks posted but not finished yet.
+            std::atomic<std::size_t> queued_tasks{0};
+            std::atomic<std::size_t> active_tasks{0};
+
+            std::mutex sleep_mutex;
+            std::condition_variable sleep_cv;
+            bool stopping = false;
 
+            // Threads sleeping in 'wait_until'.
+            std::atomic<std::size_t> waiting_threads{0};
+            std::mutex wait_mutex;
+            std::condition_variable wait_cv;
         };
 
     }        // namespace crypto3
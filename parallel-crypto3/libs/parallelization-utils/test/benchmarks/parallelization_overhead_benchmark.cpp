@@ -0,0 +1,97 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation and its affiliates.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE parallelization_overhead_benchmark_test
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+using namespace nil::crypto3;
+
+// Measures the cost of one parallel call over 'size' elements with trivial work per element, in nanoseconds.
+template<typename Call>
+double nanoseconds_per_call(std::size_t iterations, Call call) {
+    // Warm up the pool.
+    for (std::size_t i = 0; i < 10; ++i) {
+        call();
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        call();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+void run_overhead_benchmark(ThreadPool::PoolLevel pool_id, const char *level_name) {
+    for (std::size_t size : {1, 4096, 65536, 1 << 20}) {
+        std::vector<std::uint64_t> v(size, 1);
+        const std::size_t iterations = std::max<std::size_t>(10, (1 << 24) / (size + 1024));
+
+        double futures_ns = nanoseconds_per_call(iterations, [&v, size, pool_id]() {
+            wait_for_all(parallel_run_in_chunks<void>(
+                size,
+                [&v](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        v[i] += i;
+                    }
+                }, pool_id));
+        });
+
+        double latch_ns = nanoseconds_per_call(iterations, [&v, size, pool_id]() {
+            parallel_for_chunks(
+                size,
+                [&v](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        v[i] += i;
+                    }
+                }, pool_id);
+        });
+
+        std::cout << std::setw(5) << level_name << " size " << std::setw(8) << size
+                  << ": parallel_run_in_chunks + wait_for_all " << std::setw(12) << std::fixed
+                  << std::setprecision(1) << futures_ns << " ns/call, parallel_for_chunks " << std::setw(12)
+                  << latch_ns << " ns/call" << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(parallelization_overhead_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(parallelization_overhead_benchmark) {
+    std::cout << "Thread pool size: "
+              << ThreadPool::get_instance(ThreadPool::PoolLevel::LOW).get_pool_size() << std::endl;
+    run_overhead_benchmark(ThreadPool::PoolLevel::LOW, "LOW");
+    run_overhead_benchmark(ThreadPool::PoolLevel::HIGH, "HIGH");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <cstdint>
+#include <mutex>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -59,4 +60,105 @@ BOOST_AUTO_TEST_CASE(vector_multiplication_test) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(parallel_inclusive_scan_test) {
+    for (std::size_t size : {1, 2, 1000, 131071}) {
+        std::vector<std::uint64_t> v(size);
+        for (std::size_t i = 0; i < size; ++i)
+            v[i] = i + 1;
+
+        nil::crypto3::parallel_inclusive_scan(v.begin(), v.end(),
+            [](std::uint64_t a, std::uint64_t b) { return a + b; }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+
+        for (std::size_t i = 0; i < size; ++i) {
+            BOOST_CHECK(v[i] == (i + 1) * (i + 2) / 2);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_inclusive_scan_non_commutative_test) {
+    // Composition of affine maps x -> a * x + b is associative but not commutative.
+    typedef std::pair<std::uint64_t, std::uint64_t> affine_map;
+    size_t size = 65536;
+
+    std::vector<affine_map> v(size);
+    for (std::size_t i = 0; i < size; ++i)
+        v[i] = {i % 7 + 1, i % 13};
+
+    auto compose = [](const affine_map &f, const affine_map &g) {
+        return affine_map(g.first * f.first, g.first * f.second + g.second);
+    };
+
+    std::vector<affine_map> expected = v;
+    for (std::size_t i = 1; i < size; ++i)
+        expected[i] = compose(expected[i - 1], expected[i]);
+
+    nil::crypto3::parallel_inclusive_scan(v.begin(), v.end(), compose);
+
+    BOOST_CHECK(v == expected);
+}
+
+BOOST_AUTO_TEST_CASE(nested_parallelism_test) {
+    // Every level is nested into the same level and into the others, which used to deadlock with per-level pools.
+    std::size_t outer_size = 16;
+    std::size_t inner_size = 10000;
+
+    std::vector<std::vector<std::size_t>> v(outer_size, std::vector<std::size_t>(inner_size));
+
+    nil::crypto3::parallel_for(0, outer_size, [&v, inner_size](std::size_t i) {
+        nil::crypto3::parallel_for(0, inner_size, [&v, i](std::size_t j) {
+            v[i][j] = i * j;
+        }, nil::crypto3::ThreadPool::PoolLevel::LOW);
+
+        nil::crypto3::parallel_foreach(v[i].begin(), v[i].end(), [](std::size_t &x) {
+            x += 1;
+        }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+    }, nil::crypto3::ThreadPool::PoolLevel::LOW);
+
+    for (std::size_t i = 0; i < outer_size; ++i) {
+        for (std::size_t j = 0; j < inner_size; ++j) {
+            BOOST_CHECK(v[i][j] == i * j + 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(lock_across_nested_wait_test) {
+    // A waiting thread may steal the chunks of the other calls, but never another outer iteration, which would
+    // lock the mutex it already holds.
+    std::size_t outer_size = 64;
+    std::size_t inner_size = 100000;
+
+    std::mutex mutex;
+    std::vector<std::size_t> sums(outer_size);
+
+    nil::crypto3::parallel_for(0, outer_size, [&](std::size_t i) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<std::size_t> v(inner_size);
+        nil::crypto3::parallel_for(0, inner_size, [&v, i](std::size_t j) {
+            v[j] = i + j;
+        }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+        for (std::size_t x : v)
+            sums[i] += x;
+    }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+
+    for (std::size_t i = 0; i < outer_size; ++i) {
+        BOOST_CHECK(sums[i] == i * inner_size + inner_size * (inner_size - 1) / 2);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(pool_levels_share_workers_test) {
+    auto &low = nil::crypto3::ThreadPool::get_instance(nil::crypto3::ThreadPool::PoolLevel::LOW);
+    auto &high = nil::crypto3::ThreadPool::get_instance(nil::crypto3::ThreadPool::PoolLevel::HIGH);
+    auto &last = nil::crypto3::ThreadPool::get_instance(nil::crypto3::ThreadPool::PoolLevel::LASTPOOL);
+    BOOST_CHECK(&low == &high);
+    BOOST_CHECK(&low == &last);
+    BOOST_CHECK(low.get_pool_size() >= 1);
+}
+
+BOOST_AUTO_TEST_CASE(configure_after_creation_test) {
+    auto &pool = nil::crypto3::ThreadPool::get_instance(nil::crypto3::ThreadPool::PoolLevel::HIGH);
+    const std::size_t pool_size = pool.get_pool_size();
+    BOOST_CHECK(!nil::crypto3::ThreadPool::configure(pool_size + 1));
+    BOOST_CHECK_EQUAL(pool.get_pool_size(), pool_size);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -17,12 +17,20 @@
 #ifndef PROOF_GENERATOR_FILE_OPERATIONS_HPP
 #define PROOF_GENERATOR_FILE_OPERATIONS_HPP
 
+#include <cerrno>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <limits>
 #include <optional>
+#include <utility>
 #include <vector>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <boost/filesystem.hpp>
 #include <boost/log/trivial.hpp>
 
@@ -120,6 +128,73 @@ namespace nil {
             return v;
         }
 
+        /**
+         * @brief Read-only memory mapping of a whole file, unmapped on destruction.
+         */
+        class mapped_file {
+        public:
+            static std::optional<mapped_file> open(const std::string& path) {
+                const int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to open file: " << path << ": " << std::strerror(errno);
+                    return std::nullopt;
+                }
+
+                struct stat st;
+                if (::fstat(fd, &st) != 0) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to stat file: " << path << ": " << std::strerror(errno);
+                    ::close(fd);
+                    return std::nullopt;
+                }
+
+                const std::size_t size = static_cast<std::size_t>(st.st_size);
+                if (size == 0) {
+                    ::close(fd);
+                    return mapped_file(nullptr, 0);
+                }
+
+                void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                // The mapping stays valid after the descriptor is closed.
+                ::close(fd);
+                if (data == MAP_FAILED) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to map file: " << path << ": " << std::strerror(errno);
+                    return std::nullopt;
+                }
+                ::madvise(data, size, MADV_SEQUENTIAL);
+                return mapped_file(data, size);
+            }
+
+            mapped_file(mapped_file&& other) noexcept
+                : data_(std::exchange(other.data_, nullptr))
+                , size_(std::exchange(other.size_, 0)) {
+            }
+
+            mapped_file(const mapped_file&) = delete;
+            mapped_file& operator=(const mapped_file&) = delete;
+            mapped_file& operator=(mapped_file&&) = delete;
+
+            ~mapped_file() {
+                if (data_ != nullptr) {
+                    ::munmap(data_, size_);
+                }
+            }
+
+            const std::uint8_t* data() const {
+                return static_cast<const std::uint8_t*>(data_);
+            }
+
+            std::size_t size() const {
+                return size_;
+            }
+
+        private:
+            mapped_file(void* data, std::size_t size) : data_(data), size_(size) {
+            }
+
+            void* data_;
+            std::size_t size_;
+        };
+
         bool write_vector_to_file(const std::vector<std::uint8_t>& vector, const std::string& path) {
 
             auto file = open_file<std::ofstream>(path, std::ios_base::out | std::ios_base::binary);
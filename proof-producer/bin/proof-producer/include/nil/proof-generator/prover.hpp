@@ -40,6 +40,7 @@
 #include <nil/crypto3/marshalling/zk/types/placeholder/preprocessed_public_data.hpp>
 #include <nil/crypto3/marshalling/zk/types/placeholder/proof.hpp>
 #include <nil/crypto3/marshalling/zk/types/plonk/assignment_table.hpp>
+#include <nil/crypto3/marshalling/zk/types/plonk/columnar_assignment_table.hpp>
 #include <nil/crypto3/marshalling/zk/types/plonk/constraint_system.hpp>
 
 #include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
@@ -55,6 +56,10 @@
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/verifier.hpp>
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+#include <nil/actor/core/parallelization_utils.hpp>
+#endif
+
 #include <nil/blueprint/transpiler/recursive_verifier_generator.hpp>
 #include <nil/blueprint/transpiler/lpc_evm_verifier_gen.hpp>
 
@@ -181,12 +186,16 @@ namespace nil {
                 std::size_t expand_factor,
                 std::size_t max_q_chunks,
                 std::size_t grind,
-                std::string circuit_name
+                std::string circuit_name,
+                std::size_t lde_memory_limit_mb = 0,
+                std::string lde_spill_directory = ""
             ) : expand_factor_(expand_factor),
                 max_quotient_chunks_(max_q_chunks),
                 lambda_(lambda),
                 grind_(grind),
-                circuit_name_(circuit_name){
+                circuit_name_(circuit_name),
+                lde_memory_limit_mb_(lde_memory_limit_mb),
+                lde_spill_directory_(lde_spill_directory){
             }
 
             bool print_evm_verifier(
@@ -593,6 +602,17 @@ namespace nil {
             bool read_assignment_table(const boost::filesystem::path& assignment_table_file_path) {
                 BOOST_LOG_TRIVIAL(info) << "Read assignment table from " << assignment_table_file_path;
 
+                {
+                    auto mapped_table = mapped_file::open(assignment_table_file_path.string());
+                    if (!mapped_table) {
+                        return false;
+                    }
+                    if (nil::crypto3::marshalling::types::is_columnar_assignment_table(
+                            mapped_table->data(), mapped_table->size())) {
+                        return read_columnar_assignment_table(*mapped_table);
+                    }
+                }
+
                 auto marshalled_table =
                     detail::decode_marshalling_from_file<TableMarshalling>(assignment_table_file_path);
                 if (!marshalled_table) {
@@ -610,6 +630,35 @@ namespace nil {
                 return true;
             }
 
+            bool read_columnar_assignment_table(const mapped_file& mapped_table) {
+                BOOST_LOG_TRIVIAL(debug) << "Decoding columnar assignment table";
+
+                try {
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+                    auto [table_description, assignment_table] =
+                        nil::crypto3::marshalling::types::make_columnar_assignment_table<AssignmentTable>(
+                            mapped_table.data(), mapped_table.size(),
+                            [](std::size_t columns_amount, const auto& decode) {
+                                nil::crypto3::parallel_for(0, columns_amount, decode);
+                            }
+                        );
+#else
+                    auto [table_description, assignment_table] =
+                        nil::crypto3::marshalling::types::make_columnar_assignment_table<AssignmentTable>(
+                            mapped_table.data(), mapped_table.size()
+                        );
+#endif
+                    table_description_.emplace(table_description);
+                    assignment_table_.emplace(std::move(assignment_table));
+                } catch (const std::invalid_argument& e) {
+                    BOOST_LOG_TRIVIAL(error) << "Columnar assignment table decoding failed: " << e.what();
+                    return false;
+                }
+                public_inputs_.emplace(assignment_table_->public_inputs());
+
+                return true;
+            }
+
             bool set_assignment_table(const AssignmentTable& assignment_table, std::size_t used_rows_amount) {
                 BOOST_LOG_TRIVIAL(info) << "Set external assignment table" << std::endl;
 
@@ -767,6 +816,8 @@ namespace nil {
                 std::size_t table_rows_log = std::ceil(std::log2(table_description_->rows_amount));
 
                 lpc_scheme_.emplace(FriParams(1, table_rows_log, lambda_, expand_factor_, grind_!=0, grind_));
+                lpc_scheme_->get_lde_store().set_memory_limit(lde_memory_limit_mb_ << 20);
+                lpc_scheme_->get_lde_store().set_spill_directory(lde_spill_directory_);
             }
 
             bool preprocess_public_data() {
@@ -1140,6 +1191,8 @@ namespace nil {
             const std::size_t lambda_;
             const std::size_t grind_;
             const std::string circuit_name_;
+            const std::size_t lde_memory_limit_mb_;
+            const std::string lde_spill_directory_;
 
             std::optional<PublicPreprocessedData> public_preprocessed_data_;
 
@@ -93,6 +93,9 @@ namespace nil {
                 ("grind-param", make_defaulted_option(prover_options.grind), "Grind param (0)")
                 ("expand-factor,x", make_defaulted_option(prover_options.expand_factor), "Expand factor")
                 ("max-quotient-chunks,q", make_defaulted_option(prover_options.max_quotient_chunks), "Maximum quotient polynomial parts amount")
+                ("threads", make_defaulted_option(prover_options.threads), "Maximum number of worker threads of the multi-threaded prover (0 for all the cores)")
+                ("lde-memory-limit", make_defaulted_option(prover_options.lde_memory_limit_mb), "Memory in MB for keeping the committed polynomials extended to the FRI domain (0 to disable)")
+                ("lde-spill-dir", po::value(&prover_options.lde_spill_directory), "Directory for the extended polynomials which do not fit into the LDE memory limit")
                 ("evm-verifier", make_defaulted_option(prover_options.evm_verifier_path), "Output folder for EVM verifier")
                 ("input-challenge-files,u", po::value<std::vector<boost::filesystem::path>>(&prover_options.input_challenge_files)->multitoken(),
                  "Input challenge files. Used with 'generate-aggregated-challenge' stage.")
@@ -71,6 +71,11 @@ namespace nil {
             std::size_t grind = 0;
             std::size_t expand_factor = 2;
             std::size_t max_quotient_chunks = 0;
+            // LDE store of the commitment scheme, disabled when both are unset.
+            std::size_t lde_memory_limit_mb = 0;
+            std::string lde_spill_directory;
+            // 0 means the default: NIL_CRYPTO3_THREADS if set, else all the cores.
+            std::size_t threads = 0;
         };
 
         std::optional<ProverOptions> parse_args(int argc, char* argv[]);
@@ -25,6 +25,10 @@
 #include <nil/proof-generator/file_operations.hpp>
 #include <nil/proof-generator/prover.hpp>
 
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+#include <nil/actor/core/thread_pool.hpp>
+#endif
+
 #undef B0
 
 using namespace nil::proof_generator;
@@ -37,7 +41,9 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
             prover_options.expand_factor,
             prover_options.max_quotient_chunks,
             prover_options.grind,
-            prover_options.circuit_name
+            prover_options.circuit_name,
+            prover_options.lde_memory_limit_mb,
+            prover_options.lde_spill_directory
         );
         bool prover_result;
         try {
@@ -215,5 +221,14 @@ int main(int argc, char* argv[]) {
         // Action has already taken a place (help, version, etc.)
         return 0;
     }
+    if (prover_options->threads != 0) {
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+        if (!nil::crypto3::ThreadPool::configure(prover_options->threads)) {
+            BOOST_LOG_TRIVIAL(warning) << "Thread pool is already running, --threads is ignored";
+        }
+#else
+        BOOST_LOG_TRIVIAL(warning) << "Single-threaded prover, --threads is ignored";
+#endif
+    }
     return initial_wrapper(*prover_options);
 }
@@ -20,11 +20,17 @@
 #include <boost/log/sources/record_ostream.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/assert.hpp>
+#include <algorithm>
+#include <array>
 #include <ostream>  
+#include <vector>
 
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+#include <nil/crypto3/marshalling/zk/types/plonk/assignment_table.hpp>
+#include <nil/crypto3/marshalling/zk/types/plonk/columnar_assignment_table.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/export.hpp>
+#include <nil/crypto3/zk/detail/bulk_column_writer.hpp>
 #include <nil/marshalling/types/integral.hpp>
 
 #include <nil/proof-generator/output_artifacts/output_artifacts.hpp>
@@ -41,6 +47,7 @@ namespace nil {
 
                 using AssignmentTable = nil::crypto3::zk::snark::plonk_table<BlueprintField, Column>; 
                 using AssignmentTableDescription = nil::crypto3::zk::snark::plonk_table_description<BlueprintField>;
+                using Format = nil::crypto3::marshalling::types::assignment_table_format;
 
                 // marshalling traits
                 using TTypeBase = nil::marshalling::field_type<Endianness>;
@@ -64,50 +71,30 @@ namespace nil {
                     out.write(reinterpret_cast<char*>(char_array.data()), char_array.size());
                 }
 
-                /**
-                * @brief Write zero value serialized via crypto3 marshalling into output
-                * stream.
-                */
-                static void write_zero_field(std::ostream& out) {
-                    using empty_field = std::array<std::uint8_t, MarshallingField().length()>;
-                    
-                    empty_field field{};
-                    out.write(reinterpret_cast<char*>(field.data()), field.size());
-                }
-
-                /**
-                * @brief Write field element into output stream.
-                */
-                static void write_field(std::ostream& out, const BlueprintFieldValueType& input) {
-                    MarshallingField field_container(input);
-                    std::array<std::uint8_t, field_container.length()> char_array{};
-                    auto write_iter = char_array.begin();
-                    auto const status = field_container.write(write_iter, char_array.size());
-                    assert(status == nil::marshalling::status_type::success);
-
-                    out.write(reinterpret_cast<char*>(char_array.data()), char_array.size());
-                }
-
-
                 /**
                 * @brief Write table column to output stream padding with zeroes up to fixed number of values.
                 */
-                // template<typename Endianness, typename ArithmetizationType, typename ColumnType>
-                static void write_vector_value(std::ostream& out, const std::size_t padded_rows_amount, const Column& table_col) {
-                    for (std::size_t i = 0; i < padded_rows_amount; i++) {
-                        if (i < table_col.size()) {
-                            write_field(out,table_col[i]);
-                        } else {
-                            write_zero_field(out);
-                        }
-                    }
+                static void write_vector_value(nil::crypto3::zk::detail::bulk_column_writer& writer, const std::size_t padded_rows_amount, const Column& table_col) {
+                    writer.write_column(padded_rows_amount, MarshallingField::length(),
+                        [&table_col](std::size_t begin, std::size_t end, std::uint8_t* out) {
+                            nil::crypto3::marshalling::types::write_field_element_column_rows<Endianness, BlueprintFieldValueType>(
+                                table_col, begin, end, out);
+                        });
                 }
 
 
             public:
                 assignment_table_writer() = delete;
 
-                static void write_binary_assignment(std::ostream& out, const AssignmentTable& table, const AssignmentTableDescription& desc) {
+                /**
+                * @brief Write assignment table in binary form. Columnar format is the default one, the marshalled
+                * format is kept for the tools which read the tables via marshalling.
+                */
+                static void write_binary_assignment(
+                    std::ostream& out,
+                    const AssignmentTable& table,
+                    const AssignmentTableDescription& desc,
+                    Format format = Format::columnar) {
                     std::uint32_t public_input_size = table.public_inputs_amount();
                     std::uint32_t witness_size = table.witnesses_amount();
                     std::uint32_t constant_size = table.constants_amount();
@@ -121,7 +108,15 @@ namespace nil {
                     if (padded_rows_amount < 8) {
                         padded_rows_amount = 8;
                     }
-                    
+
+                    if (format == Format::columnar) {
+                        write_columnar_binary_assignment(
+                            out, table,
+                            AssignmentTableDescription(witness_size, public_input_size, constant_size, selector_size,
+                                                       usable_rows_amount, padded_rows_amount));
+                        return;
+                    }
+
                     write_size_t(out, witness_size);
                     write_size_t(out, public_input_size);
                     write_size_t(out, constant_size);
@@ -129,25 +124,66 @@ namespace nil {
                     write_size_t(out, usable_rows_amount);
                     write_size_t(out, padded_rows_amount);
 
+                    nil::crypto3::zk::detail::bulk_column_writer writer(out);
+
                     write_size_t(out, witness_size * padded_rows_amount);
                     for (std::uint32_t i = 0; i < witness_size; i++) {
-                        write_vector_value(out, padded_rows_amount,table.witness(i));
+                        write_vector_value(writer, padded_rows_amount, table.witness(i));
                     }
+                    writer.flush();
 
                     write_size_t(out, public_input_size * padded_rows_amount);
                     for (std::uint32_t i = 0; i < public_input_size; i++) {
-                        write_vector_value(out, padded_rows_amount, table.public_input(i));
+                        write_vector_value(writer, padded_rows_amount, table.public_input(i));
                     }
+                    writer.flush();
 
                     write_size_t(out, constant_size * padded_rows_amount);
                     for (std::uint32_t i = 0; i < constant_size; i++) {
-                        write_vector_value(out, padded_rows_amount,table.constant(i));
+                        write_vector_value(writer, padded_rows_amount, table.constant(i));
                     }
+                    writer.flush();
 
                     write_size_t(out, selector_size * padded_rows_amount);
                     for (std::uint32_t i = 0; i < selector_size; i++) {
-                        write_vector_value(out, padded_rows_amount, table.selector(i));
+                        write_vector_value(writer, padded_rows_amount, table.selector(i));
+                    }
+                    writer.flush();
+                }
+
+                /**
+                * @brief Write assignment table in the columnar format, see columnar_assignment_table.hpp.
+                */
+                static void write_columnar_binary_assignment(
+                    std::ostream& out,
+                    const AssignmentTable& table,
+                    const AssignmentTableDescription& desc) {
+                    namespace types = nil::crypto3::marshalling::types;
+
+                    const auto header = types::make_columnar_assignment_table_header(desc);
+                    types::write_columnar_assignment_table_header(out, header);
+
+                    nil::crypto3::zk::detail::bulk_column_writer writer(out);
+                    const auto write_column = [&](const Column& column) {
+                        writer.write_column(header.rows_amount, header.element_bytes,
+                            [&](std::size_t begin, std::size_t end, std::uint8_t* column_out) {
+                                types::write_columnar_assignment_table_column_rows<BlueprintField>(
+                                    header, column, begin, end, column_out);
+                            });
+                    };
+                    for (std::size_t i = 0; i < header.witness_columns; i++) {
+                        write_column(table.witness(i));
+                    }
+                    for (std::size_t i = 0; i < header.public_input_columns; i++) {
+                        write_column(table.public_input(i));
+                    }
+                    for (std::size_t i = 0; i < header.constant_columns; i++) {
+                        write_column(table.constant(i));
+                    }
+                    for (std::size_t i = 0; i < header.selector_columns; i++) {
+                        write_column(table.selector(i));
                     }
+                    writer.flush();
                 }
 
 
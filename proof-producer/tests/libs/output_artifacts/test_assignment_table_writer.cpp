@@ -14,6 +14,7 @@
 
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 #include <nil/crypto3/marshalling/zk/types/plonk/assignment_table.hpp>
+#include <nil/crypto3/marshalling/zk/types/plonk/columnar_assignment_table.hpp>
 
 #include <nil/proof-generator/output_artifacts/output_artifacts.hpp>
 #include <nil/proof-generator/output_artifacts/assignment_table_writer.hpp>
@@ -127,7 +128,7 @@ class AssignmentTableWriterTest: public ::testing::Test {
 TEST_F(AssignmentTableWriterTest, WriteBinaryAssignment) 
 {
     std::stringstream out;
-    Writer::write_binary_assignment(out, table_, desc_);
+    Writer::write_binary_assignment(out, table_, desc_, Writer::Format::marshalled);
     out.flush();
 
     ASSERT_EQ(out.tellp(), table_bytes_.size());
@@ -135,6 +136,34 @@ TEST_F(AssignmentTableWriterTest, WriteBinaryAssignment)
     ASSERT_TRUE(std::memcmp(written->view().data(), table_bytes_.data(), table_bytes_.size()) == 0);
 }
 
+TEST_F(AssignmentTableWriterTest, WriteColumnarBinaryAssignment) 
+{
+    std::stringstream out;
+    Writer::write_binary_assignment(out, table_, desc_);
+    out.flush();
+
+    const auto written = out.rdbuf()->view();
+    const auto* data = reinterpret_cast<const std::uint8_t*>(written.data());
+    ASSERT_TRUE(nil::crypto3::marshalling::types::is_columnar_assignment_table(data, written.size()));
+    ASSERT_FALSE(nil::crypto3::marshalling::types::is_columnar_assignment_table(table_bytes_.data(), table_bytes_.size()));
+
+    auto [desc, table] = nil::crypto3::marshalling::types::make_columnar_assignment_table<AssignmentTable>(data, written.size());
+    EXPECT_EQ(desc.witness_columns, desc_.witness_columns);
+    EXPECT_EQ(desc.public_input_columns, desc_.public_input_columns);
+    EXPECT_EQ(desc.constant_columns, desc_.constant_columns);
+    EXPECT_EQ(desc.selector_columns, desc_.selector_columns);
+    EXPECT_EQ(desc.usable_rows_amount, desc_.usable_rows_amount);
+    EXPECT_EQ(desc.rows_amount, desc_.rows_amount);
+    // The resource table is already padded, so decoding must give it back as is.
+    EXPECT_TRUE(table == table_);
+
+    // Truncated data must be rejected instead of being read out of bounds.
+    EXPECT_THROW(
+        nil::crypto3::marshalling::types::make_columnar_assignment_table<AssignmentTable>(data, written.size() - 1),
+        std::invalid_argument
+    );
+}
+
 TEST_F(AssignmentTableWriterTest, WriteFullTextAssignment) 
 {
     OutputArtifacts artifacts;
@@ -261,3 +290,49 @@ TEST_F(AssignmentTableWriterTest, TextWrite_Smoke)
     }
     ASSERT_EQ(mem_stream.tellg(), mem_stream.tellp());
 }
+
+
+TEST(AssignmentTableWriterMultipleBlocksTest, WriteBinaryAssignment)
+{
+    // More rows than one block of the bulk column writer, so that columns are encoded and written in parts.
+    constexpr std::size_t usable_rows_amount = 70000;
+    constexpr std::size_t rows_amount = 1 << 17;
+
+    const auto make_column = [](std::size_t seed) {
+        Writer::Column column(rows_amount);
+        for (std::size_t row = 0; row < usable_rows_amount; row++) {
+            column[row] = BlueprintField::value_type(seed * rows_amount + row);
+        }
+        return column;
+    };
+    AssignmentTable table(
+        std::make_shared<AssignmentTable::private_table_type>(
+            AssignmentTable::witnesses_container_type{make_column(1), make_column(2)}),
+        std::make_shared<AssignmentTable::public_table_type>(
+            AssignmentTable::public_input_container_type{make_column(3)},
+            AssignmentTable::constant_container_type{make_column(4)},
+            AssignmentTable::selector_container_type{make_column(5)}));
+    AssignmentTableDescription desc(2, 1, 1, 1, usable_rows_amount, rows_amount);
+
+    std::stringstream columnar_out;
+    Writer::write_binary_assignment(columnar_out, table, desc);
+    const auto columnar = columnar_out.rdbuf()->view();
+    auto [columnar_desc, columnar_table] = nil::crypto3::marshalling::types::make_columnar_assignment_table<AssignmentTable>(
+        reinterpret_cast<const std::uint8_t*>(columnar.data()), columnar.size());
+    EXPECT_EQ(columnar_desc.usable_rows_amount, usable_rows_amount);
+    EXPECT_EQ(columnar_desc.rows_amount, rows_amount);
+    EXPECT_TRUE(columnar_table == table);
+
+    std::stringstream marshalled_out;
+    Writer::write_binary_assignment(marshalled_out, table, desc, Writer::Format::marshalled);
+    const auto marshalled = marshalled_out.rdbuf()->view();
+    std::vector<std::uint8_t> marshalled_bytes(marshalled.begin(), marshalled.end());
+    MarshalledTable marshalled_table;
+    auto read_iter = marshalled_bytes.begin();
+    ASSERT_TRUE(marshalled_table.read(read_iter, marshalled_bytes.size()) == nil::marshalling::status_type::success);
+    auto [marshalled_desc, decoded_table] =
+        nil::crypto3::marshalling::types::make_assignment_table<Endianness, AssignmentTable>(marshalled_table);
+    EXPECT_EQ(marshalled_desc.usable_rows_amount, usable_rows_amount);
+    EXPECT_EQ(marshalled_desc.rows_amount, rows_amount);
+    EXPECT_TRUE(decoded_table == table);
+}
@@ -7,6 +7,7 @@
 #ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_WRITE_ASSIGNMENTS_HPP_
 #define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_WRITE_ASSIGNMENTS_HPP_
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cmath>
@@ -19,6 +20,9 @@
 
 #include "nil/blueprint/blueprint/plonk/assignment.hpp"
 #include "nil/crypto3/marshalling/algebra/types/field_element.hpp"
+#include "nil/crypto3/marshalling/zk/types/plonk/assignment_table.hpp"
+#include "nil/crypto3/marshalling/zk/types/plonk/columnar_assignment_table.hpp"
+#include "nil/crypto3/zk/detail/bulk_column_writer.hpp"
 #include "nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp"
 #include "nil/marshalling/types/integral.hpp"
 #include "output_artifacts.hpp"
@@ -37,59 +41,71 @@ void write_size_t(std::size_t input, std::ostream& out) {
     out.write(reinterpret_cast<char*>(char_array.data()), char_array.size());
 }
 
+
 /**
- * @brief Write zero value serialized as nil::crypto3::marshalling::types::field_element into output
- * stream.
+ * @brief Write table column padding with zeroes up to fixed number of values.
  */
-template<typename Endianness, typename ArithmetizationType>
-inline void write_zero_field(std::ostream& out) {
+template<typename Endianness, typename ArithmetizationType, typename ColumnType>
+void write_vector_value(const std::size_t padded_rows_amount, const ColumnType& table_col,
+                        nil::crypto3::zk::detail::bulk_column_writer& writer) {
     using TTypeBase = nil::marshalling::field_type<Endianness>;
-    using AssignmentTableType = nil::blueprint::assignment<ArithmetizationType>;
-    using field_element = nil::crypto3::marshalling::types::field_element<
-        TTypeBase, typename AssignmentTableType::field_type::value_type>;
-    std::array<std::uint8_t, field_element().length()> array{};
-    out.write(reinterpret_cast<char*>(array.data()), array.size());
+    using value_type =
+        typename nil::blueprint::assignment<ArithmetizationType>::field_type::value_type;
+    using field_element = nil::crypto3::marshalling::types::field_element<TTypeBase, value_type>;
+
+    writer.write_column(padded_rows_amount, field_element::length(),
+                        [&table_col](std::size_t begin, std::size_t end, std::uint8_t* out) {
+                            nil::crypto3::marshalling::types::write_field_element_column_rows<
+                                Endianness, value_type>(table_col, begin, end, out);
+                        });
 }
 
 /**
- * @brief Write field element into output stream.
+ * @brief Write assignment table in the columnar format, see columnar_assignment_table.hpp.
  */
-template<typename Endianness, typename ArithmetizationType>
-void write_field(
-    const typename nil::blueprint::assignment<ArithmetizationType>::field_type::value_type& input,
+template<typename ArithmetizationType, typename BlueprintFieldType>
+void write_columnar_assignment(
+    const nil::blueprint::assignment<ArithmetizationType>& table,
+    const nil::crypto3::zk::snark::plonk_table_description<BlueprintFieldType>& desc,
     std::ostream& out) {
-    using TTypeBase = nil::marshalling::field_type<Endianness>;
-    using AssignmentTableType = nil::blueprint::assignment<ArithmetizationType>;
-    auto field_container = nil::crypto3::marshalling::types::field_element<
-        TTypeBase, typename AssignmentTableType::field_type::value_type>(input);
-    std::array<std::uint8_t, field_container.length()> char_array{};
-    auto write_iter = char_array.begin();
-    assert(field_container.write(write_iter, char_array.size()) ==
-           nil::marshalling::status_type::success);
-    out.write(reinterpret_cast<char*>(char_array.data()), char_array.size());
-}
+    namespace types = nil::crypto3::marshalling::types;
+    using column_type = typename nil::crypto3::zk::snark::plonk_column<BlueprintFieldType>;
 
-/**
- * @brief Write table column to output stream padding with zeroes up to fixed number of values.
- */
-template<typename Endianness, typename ArithmetizationType, typename ColumnType>
-void write_vector_value(const std::size_t padded_rows_amount, const ColumnType& table_col,
-                        std::ostream& out) {
-    for (std::size_t i = 0; i < padded_rows_amount; i++) {
-        if (i < table_col.size()) {
-            write_field<Endianness, ArithmetizationType>(table_col[i], out);
-        } else {
-            write_zero_field<Endianness, ArithmetizationType>(out);
-        }
+    const auto header = types::make_columnar_assignment_table_header(desc);
+    types::write_columnar_assignment_table_header(out, header);
+
+    nil::crypto3::zk::detail::bulk_column_writer writer(out);
+    const auto write_column = [&](const column_type& column) {
+        writer.write_column(header.rows_amount, header.element_bytes,
+                            [&](std::size_t begin, std::size_t end, std::uint8_t* column_out) {
+                                types::write_columnar_assignment_table_column_rows<
+                                    BlueprintFieldType>(header, column, begin, end, column_out);
+                            });
+    };
+    for (std::uint32_t i = 0; i < header.witness_columns; i++) {
+        write_column(table.witness(i));
+    }
+    for (std::uint32_t i = 0; i < header.public_input_columns; i++) {
+        write_column(table.public_input(i));
     }
+    for (std::uint32_t i = 0; i < header.constant_columns; i++) {
+        write_column(table.constant(i));
+    }
+    for (std::uint32_t i = 0; i < header.selector_columns; i++) {
+        write_column(table.selector(i));
+    }
+    writer.flush();
 }
 
 /**
- * @brief Write assignment table serialized into binary to output stream.
+ * @brief Write assignment table serialized into binary to output stream. Columnar format is written
+ * by default, marshalled format is kept for the tools which read the tables via marshalling.
  */
 template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType>
 void write_binary_assignment(const nil::blueprint::assignment<ArithmetizationType>& table,
-                             std::ostream& out) {
+                             std::ostream& out,
+                             nil::crypto3::marshalling::types::assignment_table_format format =
+                                 nil::crypto3::marshalling::types::assignment_table_format::columnar) {
     std::uint32_t public_input_size = table.public_inputs_amount();
     std::uint32_t witness_size = table.witnesses_amount();
     std::uint32_t constant_size = table.constants_amount();
@@ -125,6 +141,16 @@ void write_binary_assignment(const nil::blueprint::assignment<ArithmetizationTyp
         padded_rows_amount = 8;
     }
 
+    if (format == nil::crypto3::marshalling::types::assignment_table_format::columnar) {
+        write_columnar_assignment<ArithmetizationType, BlueprintFieldType>(
+            table,
+            nil::crypto3::zk::snark::plonk_table_description<BlueprintFieldType>(
+                witness_size, public_input_size, constant_size, selector_size, usable_rows_amount,
+                padded_rows_amount),
+            out);
+        return;
+    }
+
     using column_type = typename nil::crypto3::zk::snark::plonk_column<BlueprintFieldType>;
 
     write_size_t<Endianness>(witness_size, out);
@@ -134,29 +160,35 @@ void write_binary_assignment(const nil::blueprint::assignment<ArithmetizationTyp
     write_size_t<Endianness>(usable_rows_amount, out);
     write_size_t<Endianness>(padded_rows_amount, out);
 
+    nil::crypto3::zk::detail::bulk_column_writer writer(out);
+
     write_size_t<Endianness>(witness_size * padded_rows_amount, out);
     for (std::uint32_t i = 0; i < witness_size; i++) {
         write_vector_value<Endianness, ArithmetizationType, column_type>(padded_rows_amount,
-                                                                         table.witness(i), out);
+                                                                         table.witness(i), writer);
     }
+    writer.flush();
 
     write_size_t<Endianness>(public_input_size * padded_rows_amount, out);
     for (std::uint32_t i = 0; i < public_input_size; i++) {
         write_vector_value<Endianness, ArithmetizationType, column_type>(
-            padded_rows_amount, table.public_input(i), out);
+            padded_rows_amount, table.public_input(i), writer);
     }
+    writer.flush();
 
     write_size_t<Endianness>(constant_size * padded_rows_amount, out);
     for (std::uint32_t i = 0; i < constant_size; i++) {
         write_vector_value<Endianness, ArithmetizationType, column_type>(padded_rows_amount,
-                                                                         table.constant(i), out);
+                                                                         table.constant(i), writer);
     }
+    writer.flush();
 
     write_size_t<Endianness>(selector_size * padded_rows_amount, out);
     for (std::uint32_t i = 0; i < selector_size; i++) {
         write_vector_value<Endianness, ArithmetizationType, column_type>(padded_rows_amount,
-                                                                         table.selector(i), out);
+                                                                         table.selector(i), writer);
     }
+    writer.flush();
 }
 
 /**